@@ -0,0 +1,39 @@
+#include <stdio.h>
+#include <string.h>
+#include "engine.h"
+
+static const char *grammar=
+  "Pairs	<- Pair (',' Pair)* !.\n"
+  "Pair	<- Space Key '=' Space Value Space\n"
+  "Key	<- < [a-z]+ > Space	{ key }\n"
+  "Value	<- < [0-9]+ >		{ number }\n"
+  "	 / '\"' < [^\"]* > '\"'	{ string }\n"
+  "Space	<- [ \\t]*\n";
+
+static void capture(void *data, const char *name, const char *text, int length, int offset)
+{
+  printf("%d %s '%s'\n", offset, name, text);
+}
+
+int main()
+{
+  char	       error[256], line[1024];
+  peg_grammar *g= peg_load(grammar, error, sizeof(error));
+
+  if (!g)
+    {
+      fprintf(stderr, "%s\n", error);
+      return 1;
+    }
+  while (fgets(line, sizeof(line), stdin))
+    {
+      int length= strcspn(line, "\n");
+      printf("%d\n", peg_match(g, 0, line, length, capture, 0));
+    }
+  printf("%d\n", peg_match(g, "Value", "\"abc\"", 5, capture, 0));
+  peg_free(g);
+  if (!peg_load("Start <- &{ 1 } 'x'\n", error, sizeof(error)))	printf("%s\n", error);
+  if (!peg_load("Start <- Missing\n", error, sizeof(error)))	printf("%s\n", error);
+  if (!peg_load("Start <- 'x\n", error, sizeof(error)))		printf("%s\n", error);
+  return 0;
+}
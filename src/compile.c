@@ -55,7 +55,7 @@ static inline int hexval(int c)
     return 0;
 }
 
-static int cnext(unsigned char **ccp)
+int cnext(unsigned char **ccp)
 {
     unsigned char *cclass= *ccp;
     int c= *cclass++;
@@ -110,13 +110,10 @@ static const char *escapedChar(int ch)
     return NULL;
 }
 
-static char *makeCharClass(unsigned char *cclass, int caseInsensitive)
+static void charClassBits(unsigned char *cclass, int caseInsensitive, unsigned char bits[32])
 {
-  unsigned char	 bits[32];
   setter	 set;
   int		 c, prev= -1;
-  static char	 string[256];
-  char		*ptr;
 
   if ('^' == *cclass)
     {
@@ -146,6 +143,16 @@ static char *makeCharClass(unsigned char *cclass, int caseInsensitive)
 	  set(bits, prev= c);
 	}
     }
+}
+
+char *makeCharClass(unsigned char *cclass, int caseInsensitive)
+{
+  unsigned char	 bits[32];
+  int		 c;
+  static char	 string[256];
+  char		*ptr;
+
+  charClassBits(cclass, caseInsensitive, bits);
 
   ptr= string;
   for (c= 0;  c < 32;  ++c)
@@ -154,17 +161,507 @@ static char *makeCharClass(unsigned char *cclass, int caseInsensitive)
   return string;
 }
 
+/* Add the characters that can begin a successful match of node to set,
+ * and answer whether node can succeed without consuming input.
+ */
+static int firstSet(Node *node, unsigned char set[32], unsigned char (*first)[32], char *nullable)
+{
+  switch (node->type)
+    {
+    case Dot:
+      memset(set, 255, 32);
+      return 0;
+
+    case Name:
+      {
+	int i, id= node->name.rule->rule.id;
+	for (i= 0;  i < 32;  ++i)
+	  set[i] |= first[id][i];
+	return nullable[id];
+      }
+
+    case Character:
+    case String:
+      {
+	unsigned char *value= (unsigned char *)node->string.value;
+	int c;
+	if (!*value) return 1;
+	c= cnext(&value);
+	charClassSet(set, c);
+	if (node->string.caseInsensitive)
+	  {
+	    charClassSet(set, tolower(c));
+	    charClassSet(set, toupper(c));
+	  }
+	return 0;
+      }
+
+    case Class:
+      {
+	unsigned char bits[32];
+	int c, d;
+	charClassBits(node->cclass.value, node->cclass.caseInsensitive, bits);
+	for (c= 0;  c < 256;  ++c)
+	  {
+	    d= node->cclass.caseInsensitive ? tolower(c) : c;
+	    if (bits[d >> 3] & (1 << (d & 7)))
+	      charClassSet(set, c);
+	  }
+	return 0;
+      }
+
+    case Error:
+      return firstSet(node->error.element, set, first, nullable);
+
+    case Alternate:
+      {
+	int result= 0;
+	for (node= node->alternate.first;  node;  node= node->alternate.next)
+	  result |= firstSet(node, set, first, nullable);
+	return result;
+      }
+
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	if (!firstSet(node, set, first, nullable))
+	  return 0;
+      return 1;
+
+    case Query:
+    case Star:
+      firstSet(node->query.element, set, first, nullable);
+      return 1;
+
+    case Plus:
+      return firstSet(node->plus.element, set, first, nullable);
+
+    default:	/* Action, Inline, Predicate, PeekFor, PeekNot */
+      return 1;
+    }
+}
+
+void Rule_compute_first(Node *node, unsigned char (*first)[32], char *nullable)
+{
+  int changed;
+  do
+    {
+      Node *n;
+      changed= 0;
+      for (n= node;  n;  n= n->rule.next)
+	{
+	  unsigned char set[32];
+	  int id= n->rule.id, result;
+	  if (!n->rule.expression) continue;
+	  memset(set, 0, sizeof(set));
+	  result= firstSet(n->rule.expression, set, first, nullable);
+	  if (result != nullable[id] || memcmp(set, first[id], 32))
+	    {
+	      nullable[id]= result;
+	      memcpy(first[id], set, 32);
+	      changed= 1;
+	    }
+	}
+    }
+  while (changed);
+}
+
 static void begin(void)		{ fprintf(output, "\n  {"); }
 static void end(void)		{ fprintf(output, "\n  }"); }
 static void label(int n)	{ fprintf(output, "\n  l%d:;\t", n); }
 static void jump(int n)		{ fprintf(output, "  goto l%d;", n); }
 static void save(int n)		{ fprintf(output, "  int yypos%d= yy->__pos, yythunkpos%d= yy->__thunkpos;", n, n); }
 #ifdef WITH_RESTORE_IF
-static void restore(int n)	{ fprintf(output,     "  if(yy->__pos != yypos%d) yy->__pos= yypos%d; if(yy->__thunkpos != yythunkpos%d) yy->__thunkpos= yythunkpos%d;", n, n, n, n); }
+static void restore(int n)	{ fprintf(output, "  YY_HEAT(yy, yypos%d);  if(yy->__pos != yypos%d) yy->__pos= yypos%d; if(yy->__thunkpos != yythunkpos%d) yy->__thunkpos= yythunkpos%d;", n, n, n, n, n); }
 #else
-static void restore(int n)	{ fprintf(output,     "  yy->__pos= yypos%d; yy->__thunkpos= yythunkpos%d;", n, n); }
+static void restore(int n)	{ fprintf(output, "  YY_HEAT(yy, yypos%d);  yy->__pos= yypos%d; yy->__thunkpos= yythunkpos%d;", n, n, n); }
 #endif
 
+/* A recognizer (-R) keeps only what affects matching.  Captures ('<'
+ * and '>') are kept only if some semantic predicate might examine
+ * yytext.
+ */
+
+static int recognizerText= 1;
+
+static int isCapture(Node *node)
+{
+  return !strcmp(node->predicate.text, "YY_BEGIN") || !strcmp(node->predicate.text, "YY_END");
+}
+
+static int needsText(Node *node)
+{
+  if (!node) return 0;
+  switch (node->type)
+    {
+    case Predicate:	return !isCapture(node);
+    case Error:		return needsText(node->error.element);
+    case Alternate:
+    case Sequence:
+      {
+	Node *n;
+	for (n= node->alternate.first;  n;  n= n->alternate.next)
+	  if (needsText(n))
+	    return 1;
+      }
+      return 0;
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:		return needsText(node->query.element);
+    default:		return 0;
+    }
+}
+
+/* Alternatives are numbered once, before any code is generated, so that
+ * YY_RULES_PROFILE can count attempts and successes for each of them.
+ * Each Alternate node records the number of its first alternative; an
+ * expression that is compiled more than once (the element of a Plus)
+ * reuses the same numbers.  yyalternatives[] maps each number back to its
+ * rule and to the alternative's position in the rule's source.
+ */
+
+static Node **altRules= 0;
+static int   *altIndices= 0;
+static int    altCount= 0;
+
+/* Profile-guided ordering (-O).  Each alternative is numbered in source
+ * order before any are moved, so that the numbers reported by
+ * YY_RULES_PROFILE stay the same whichever order they are compiled in.
+ * An alternative is moved ahead of its predecessor only if neither can
+ * match the empty string, their FIRST sets are disjoint (so at most one
+ * of them can succeed at any position), and neither runs user code while
+ * matching.  Tests in an alternative that succeeds in more than half of
+ * the attempts at its choice are marked YY_UNLIKELY to fail.
+ */
+
+static Sample *samples= 0;
+static int     sampleCount= 0;
+static Node  **numberedNodes= 0;
+static int    *numberedIndices= 0;
+static char   *numberedHot= 0;
+static int     numberedCount= 0;
+static int     hotKo= -1;
+
+static int numberAlternatives(Node *node, int index)
+{
+  switch (node->type)
+    {
+    case Rule:		return node->rule.expression ? numberAlternatives(node->rule.expression, index) : index;
+    case Error:		return numberAlternatives(node->error.element, index);
+    case Alternate:
+    case Sequence:
+      {
+	Node *n;
+	for (n= node->alternate.first;  n;  n= n->alternate.next)
+	  {
+	    if (Alternate == node->type)
+	      {
+		numberedNodes= realloc(numberedNodes, sizeof(Node *) * (numberedCount + 1));
+		numberedIndices= realloc(numberedIndices, sizeof(int) * (numberedCount + 1));
+		numberedHot= realloc(numberedHot, numberedCount + 1);
+		numberedNodes[numberedCount]= n;
+		numberedIndices[numberedCount]= ++index;
+		numberedHot[numberedCount++]= 0;
+	      }
+	    index= numberAlternatives(n, index);
+	  }
+      }
+      return index;
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:		return numberAlternatives(node->query.element, index);
+    default:		return index;
+    }
+}
+
+static int alternativeNumber(Node *node)
+{
+  int i;
+  for (i= 0;  i < numberedCount;  ++i)
+    if (numberedNodes[i] == node)
+      return i;
+  return -1;
+}
+
+static int hasEffects(Node *node, char *visited)
+{
+  switch (node->type)
+    {
+    case Name:
+      {
+	Node *rule= node->name.rule;
+	if (!rule->rule.expression) return 1;
+	if (visited[rule->rule.id]) return 0;
+	visited[rule->rule.id]= 1;
+	return hasEffects(rule->rule.expression, visited);
+      }
+    case Inline:
+    case Error:		return 1;
+    case Predicate:	return !isCapture(node);
+    case Alternate:
+    case Sequence:
+      for (node= node->alternate.first;  node;  node= node->alternate.next)
+	if (hasEffects(node, visited))
+	  return 1;
+      return 0;
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:		return hasEffects(node->query.element, visited);
+    default:		return 0;
+    }
+}
+
+static Sample *addSample(char *rule, int index)
+{
+  Sample *sample= Profile_find(rule, index);
+  if (sample->rule) return sample;
+  samples= realloc(samples, sizeof(Sample) * ++sampleCount);
+  sample= samples + sampleCount - 1;
+  memset(sample, 0, sizeof(Sample));
+  sample->rule= strdup(rule);
+  sample->index= index;
+  return sample;
+}
+
+/* Read a profile written by yyShowRulesProfileCSV() or pegprof, or the
+ * report printed by yyShowRulesProfile().  The report's tables are
+ * recognised by their headings; its table of counts is not read since
+ * zero counts are printed as blanks, and the calls and self time of
+ * each rule are taken from its table of times instead.  Counts for the
+ * same rule or alternative (several profiles concatenated) are summed.
+ */
+void Profile_read(char *fileName)
+{
+  FILE *in= fopen(fileName, "r");
+  char  line[1024], name[256], *slash;
+  unsigned long long succeed, fail, self, tries, hits, wasted;
+  int   index, table= 0;
+  Sample *sample;
+
+  if (!in)
+    {
+      perror(fileName);
+      exit(1);
+    }
+  while (fgets(line, sizeof(line), in))
+    {
+      if (strstr(line, "inclusive") && strstr(line, "definition")) table= 1;
+      if (strstr(line, "wasted") && strstr(line, "alternative")) table= 2;
+      if (5 == sscanf(line, "alternative,%255[^,],%*d,%*d,%d,%*u,%*u,%*u,%*u,%llu,%llu,%llu", name, &index, &tries, &hits, &wasted))
+	;
+      else if (4 == sscanf(line, "rule,%255[^,],%*d,%*d,%*d,%llu,%llu,%llu", name, &succeed, &fail, &self))
+	{
+	  sample= addSample(name, 0);
+	  sample->calls += succeed + fail;
+	  sample->succeed += succeed;
+	  sample->fail += fail;
+	  sample->self += self;
+	  continue;
+	}
+      else if (1 == table && 3 == sscanf(line, "%*d %llu %*f %*u %llu %255s", &self, &succeed, name))
+	{
+	  sample= addSample(name, 0);
+	  sample->calls += succeed;
+	  sample->self += self;
+	  continue;
+	}
+      else if (2 == table && 4 == sscanf(line, "%*d %llu %llu %*f %llu %255s", &tries, &hits, &wasted, name)
+	       && (slash= strrchr(name, '/')) && isdigit(slash[1]))
+	{
+	  *slash++= '\0';
+	  index= atoi(slash);
+	}
+      else
+	continue;
+      sample= addSample(name, index);
+      sample->tries += tries;
+      sample->hits += hits;
+      sample->wasted += wasted;
+    }
+  fclose(in);
+}
+
+Sample *Profile_find(char *rule, int index)
+{
+  static Sample none;
+  int i;
+  for (i= 0;  i < sampleCount;  ++i)
+    if (samples[i].index == index && !strcmp(samples[i].rule, rule))
+      return samples + i;
+  return &none;
+}
+
+static void orderAlternatives(Node *rule, Node *node, unsigned char (*first)[32], char *nullable)
+{
+  switch (node->type)
+    {
+    case Error:		orderAlternatives(rule, node->error.element, first, nullable);  return;
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:		orderAlternatives(rule, node->query.element, first, nullable);  return;
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	orderAlternatives(rule, node, first, nullable);
+      return;
+    case Alternate:
+      break;
+    default:
+      return;
+    }
+  {
+    int      count= 0, i, j, moved= 0;
+    long     entries;
+    Node    *n, **elements;
+    Sample **counts;
+    unsigned char (*sets)[32];
+    char    *empty, *effects, *visited= calloc(ruleCount + 1, 1);
+
+    for (n= node->alternate.first;  n;  n= n->alternate.next)
+      {
+	orderAlternatives(rule, n, first, nullable);
+	++count;
+      }
+    elements= calloc(count, sizeof(Node *));
+    counts= calloc(count, sizeof(Sample *));
+    sets= calloc(count, 32);
+    empty= calloc(count, 1);
+    effects= calloc(count, 1);
+    for (i= 0, n= node->alternate.first;  n;  n= n->alternate.next, ++i)
+      {
+	elements[i]= n;
+	counts[i]= Profile_find(rule->rule.name, numberedIndices[alternativeNumber(n)]);
+	empty[i]= firstSet(n, sets[i], first, nullable);
+	memset(visited, 0, ruleCount + 1);
+	effects[i]= hasEffects(n, visited);
+      }
+    entries= counts[0]->tries;
+    for (i= 1;  i < count;  ++i)
+      for (j= i;  j > 0 && counts[j]->hits > counts[j - 1]->hits;  --j)
+	{
+	  int k, overlap= 0;
+	  char *reason= 0;
+	  for (k= 0;  k < 32;  ++k)
+	    overlap |= sets[j][k] & sets[j - 1][k];
+	  if	  (empty[j] || empty[j - 1])	reason= "can match the empty string";
+	  else if (effects[j] || effects[j - 1])	reason= "runs user code";
+	  else if (overlap)			reason= "FIRST sets overlap";
+	  if (reason)
+	    {
+	      fprintf(stderr, "rule '%s' alternative %d (%llu hits) not moved before %d (%llu hits): %s\n", rule->rule.name,
+		      numberedIndices[alternativeNumber(elements[j])], counts[j]->hits,
+		      numberedIndices[alternativeNumber(elements[j - 1])], counts[j - 1]->hits, reason);
+	      break;
+	    }
+#define swap(T, A)  { T t= A[j];  A[j]= A[j - 1];  A[j - 1]= t; }
+	  swap(Node *, elements);
+	  swap(Sample *, counts);
+	  swap(char, empty);
+	  swap(char, effects);
+#undef swap
+	  for (k= 0;  k < 32;  ++k)
+	    {
+	      unsigned char t= sets[j][k];
+	      sets[j][k]= sets[j - 1][k];
+	      sets[j - 1][k]= t;
+	    }
+	  moved= 1;
+	}
+    if (moved)
+      {
+	fprintf(stderr, "rule '%s' alternatives reordered", rule->rule.name);
+	for (i= 0;  i < count;  ++i)
+	  fprintf(stderr, " %d", numberedIndices[alternativeNumber(elements[i])]);
+	fprintf(stderr, "\n");
+	node->alternate.first= elements[0];
+	for (i= 1;  i < count;  ++i)
+	  elements[i - 1]->alternate.next= elements[i];
+	elements[count - 1]->alternate.next= 0;
+	node->alternate.last= elements[count - 1];
+      }
+    for (i= 0;  i < count;  ++i)
+      if (2 * counts[i]->hits > entries)
+	numberedHot[alternativeNumber(elements[i])]= 1;
+    free(visited);
+    free(effects);
+    free(empty);
+    free(sets);
+    free(counts);
+    free(elements);
+  }
+}
+
+void Rule_apply_profile(Node *node, char *fileName)
+{
+  unsigned char (*first)[32]= calloc(ruleCount + 1, 32);
+  char		 *nullable= calloc(ruleCount + 1, 1);
+  Node		 *n;
+
+  Profile_read(fileName);
+  for (n= node;  n;  n= n->rule.next)
+    numberAlternatives(n, 0);
+  Rule_compute_first(node, first, nullable);
+  for (n= node;  n;  n= n->rule.next)
+    if (n->rule.expression)
+      orderAlternatives(n, n->rule.expression, first, nullable);
+  free(nullable);
+  free(first);
+}
+
+static int numberCompiledAlternatives(Node *rule, Node *node, int index)
+{
+  switch (node->type)
+    {
+    case Rule:		return node->rule.expression ? numberCompiledAlternatives(node, node->rule.expression, 0) : index;
+    case Error:		return numberCompiledAlternatives(rule, node->error.element, index);
+    case Alternate:
+      {
+	Node *n;
+	int   alt;
+	for (n= node->alternate.first, alt= 0;  n;  n= n->alternate.next)
+	  ++alt;
+	node->alternate.number= altCount + 1;
+	altCount += alt;
+	altRules= realloc(altRules, sizeof(Node *) * (altCount + 1));
+	altIndices= realloc(altIndices, sizeof(int) * (altCount + 1));
+	for (n= node->alternate.first, alt= node->alternate.number;  n;  n= n->alternate.next, ++alt)
+	  {
+	    int number= alternativeNumber(n);
+	    altRules[alt]= rule;
+	    altIndices[alt]= number < 0 ? ++index : numberedIndices[number];
+	    index= numberCompiledAlternatives(rule, n, index);
+	  }
+      }
+      return index;
+    case Sequence:
+      {
+	Node *n;
+	for (n= node->sequence.first;  n;  n= n->sequence.next)
+	  index= numberCompiledAlternatives(rule, n, index);
+      }
+      return index;
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:		return numberCompiledAlternatives(rule, node->query.element, index);
+    default:		return index;
+    }
+}
+
+static char *failIf(int ko)	{ return ko == hotKo ? "  if (YY_UNLIKELY(!" : "  if (!"; }
+static char *failThen(int ko)	{ return ko == hotKo ? ")" : ""; }
+
+static void beginAlternative(int alt)		{ fprintf(output, "\n  YY_ALT_TRY(%d);", alt); }
+static void succeedAlternative(int alt)		{ fprintf(output, "  YY_ALT_HIT(%d);", alt); }
+static void failAlternative(int alt, int pos)	{ fprintf(output, "  YY_ALT_MISS(%d, yypos%d);", alt, pos); }
+
 static void Node_compile_c_ko(Node *node, int ko)
 {
   assert(node);
@@ -176,12 +673,12 @@ static void Node_compile_c_ko(Node *node, int ko)
       break;
 
     case Dot:
-      fprintf(output, "  if (!yymatchDot(yy)) goto l%d;", ko);
+      fprintf(output, "%syymatchDot(yy))%s goto l%d;", failIf(ko), failThen(ko), ko);
       break;
 
     case Name:
-      fprintf(output, "  if (!yy_%s(yy)) goto l%d;", node->name.rule->rule.name, ko);
-      if (node->name.variable)
+      fprintf(output, "%syy_%s(yy))%s goto l%d;", failIf(ko), node->name.rule->rule.name, failThen(ko), ko);
+      if (node->name.variable && !recognizer)
 	fprintf(output, "  yyDo(yy, yySet, %d, 0);", node->name.variable->variable.offset);
       break;
 
@@ -193,34 +690,36 @@ static void Node_compile_c_ko(Node *node, int ko)
 	if (1 == len)
 	  {
             const char *chStr = escapedChar(node->string.value[0]);
-	    fprintf(output, "  if (!yymatchChar%s(yy, '%s')) goto l%d;", caseType, chStr ? chStr : node->string.value, ko);
+	    fprintf(output, "%syymatchChar%s(yy, '%s'))%s goto l%d;", failIf(ko), caseType, chStr ? chStr : node->string.value, failThen(ko), ko);
 	  }
 	else
 	  if (2 == len && '\\' == node->string.value[0])
-	    fprintf(output, "  if (!yymatchChar%s(yy, '%s')) goto l%d;", caseType, node->string.value, ko);
+	    fprintf(output, "%syymatchChar%s(yy, '%s'))%s goto l%d;", failIf(ko), caseType, node->string.value, failThen(ko), ko);
 	  else
           {
-	    fprintf(output, "  if (!yymatchString%s(yy, \"", caseType);
+	    fprintf(output, "%syymatchString%s(yy, \"", failIf(ko), caseType);
             for(int i=0; i < len; ++i) {
                 if(node->string.value[i] == '"' && node->string.value[i-1] != '\\') fputc('\\', output);
                 fputc(node->string.value[i], output);
             }
-	    fprintf(output, "\")) goto l%d;", ko);
+	    fprintf(output, "\"))%s goto l%d;", failThen(ko), ko);
           }
       }
       break;
 
     case Class:
-      fprintf(output, "  if (!yymatchClass%s(yy, (unsigned char *)\"%s\")) goto l%d;",
+      fprintf(output, "%syymatchClass%s(yy, (unsigned char *)\"%s\"))%s goto l%d;", failIf(ko),
               node->cclass.caseInsensitive ? "CaseInsensitive" : "",
-              makeCharClass(node->cclass.value, node->cclass.caseInsensitive), ko);
+              makeCharClass(node->cclass.value, node->cclass.caseInsensitive), failThen(ko), ko);
       break;
 
     case Action:
-      fprintf(output, "  yyDo(yy, yy%s, yy->__begin, yy->__end);", node->action.name);
+      if (!recognizer)
+	fprintf(output, "  yyDo(yy, yy%s, yy->__begin, yy->__end);", node->action.name);
       break;
 
     case Inline:
+      if (recognizer) break;
       fprintf(output, "  yyText(yy, yy->__begin, yy->__end);\n");
       fprintf(output, "#define yytext yy->__text\n");
       fprintf(output, "#define yyleng yy->__textlen\n");
@@ -230,6 +729,12 @@ static void Node_compile_c_ko(Node *node, int ko)
       break;
 
     case Predicate:
+      if (recognizer && isCapture(node))
+	{
+	  if (recognizerText)
+	    fprintf(output, "  if (!(%s)) goto l%d;", node->predicate.text, ko);
+	  break;
+	}
       fprintf(output, "  yyText(yy, yy->__begin, yy->__end);  {\n");
       fprintf(output, "#define yytext yy->__text\n");
       fprintf(output, "#define yyleng yy->__textlen\n");
@@ -242,6 +747,11 @@ static void Node_compile_c_ko(Node *node, int ko)
     case Error:
       {
 	int eok= yyl(), eko= yyl();
+	if (recognizer)
+	  {
+	    Node_compile_c_ko(node->error.element, ko);
+	    break;
+	  }
 	Node_compile_c_ko(node->error.element, eko);
 	jump(eok);
 	label(eko);
@@ -259,20 +769,26 @@ static void Node_compile_c_ko(Node *node, int ko)
 
     case Alternate:
       {
-	int ok= yyl();
+	int ok= yyl(), alt= node->alternate.number;
 	begin();
 	save(ok);
-	for (node= node->alternate.first;  node;  node= node->alternate.next)
-	  if (node->alternate.next)
-	    {
-	      int next= yyl();
-	      Node_compile_c_ko(node, next);
-	      jump(ok);
-	      label(next);
+	for (node= node->alternate.first;  node;  node= node->alternate.next, ++alt)
+	  {
+	    int next= yyl(), number= alternativeNumber(node), hot= hotKo;
+	    beginAlternative(alt);
+	    if (number >= 0 && numberedHot[number]) hotKo= next;
+	    if (!node->alternate.next && hot == ko) hotKo= next;
+	    Node_compile_c_ko(node, next);
+	    hotKo= hot;
+	    succeedAlternative(alt);
+	    jump(ok);
+	    label(next);
+	    failAlternative(alt, ok);
+	    if (node->alternate.next)
 	      restore(ok);
-	    }
-	  else
-	    Node_compile_c_ko(node, ko);
+	    else
+	      jump(ko);
+	  }
 	end();
 	label(ok);
       }
@@ -413,23 +929,19 @@ static void Rule_compile_c2(Node *node)
 
       fprintf(output, "\nYY_RULE(int) yy_%s(yycontext *yy)\n{", node->rule.name);
       if (!safe) save(0);
-      if (node->rule.variables)
+      fprintf(output, "\n  YY_RULE_PROLOGUE(yy, %d);", node->rule.id);
+      if (node->rule.variables && !recognizer)
 	fprintf(output, "  yyDo(yy, yyPush, %d, 0);", countVariables(node->rule.variables));
-      fprintf(output, "\n  yyprintf((stderr, \"%%*.s%%s\\n\", yy->__calldepth++, __yyindentspaces, \"%s\"));", node->rule.name);
       Node_compile_c_ko(node->rule.expression, ko);
-      fprintf(output, "\n#ifdef YY_RULES_PROFILE\n++yy->__rules_succeed_count[%d];\n#endif", node->rule.id);
-      fprintf(output, "\n  yyprintf((stderr, \"%%*.s  ok   %%s @%%d:%%d %%s\\n\", yy->__calldepth--, __yyindentspaces, \"%s\", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+%s));",
-                node->rule.name, !safe ? "yypos0" : "yy->__pos");
-      if (node->rule.variables)
+      if (node->rule.variables && !recognizer)
 	fprintf(output, "  yyDo(yy, yyPop, %d, 0);", countVariables(node->rule.variables));
+      fprintf(output, "\n  YY_RULE_EPILOGUE(yy, %d, %s, 1);", node->rule.id, !safe ? "yypos0" : "yy->__pos");
       fprintf(output, "\n  return 1;");
       if (!safe)
 	{
 	  label(ko);
 	  restore(0);
-	  fprintf(output, "\n#ifdef YY_RULES_PROFILE\n++yy->__rules_fail_count[%d];\n#endif", node->rule.id);
-	  fprintf(output, "\n  yyprintf((stderr, \"%%*.s  fail %%s @%%d:%%d %%s\\n\", yy->__calldepth--, __yyindentspaces, \"%s\", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+%s));",
-                  node->rule.name, !safe ? "yypos0" : "yy->__pos");
+	  fprintf(output, "\n  YY_RULE_EPILOGUE(yy, %d, yypos0, 0);", node->rule.id);
 	  fprintf(output, "\n  return 0;");
 	}
       fprintf(output, "\n}");
@@ -465,6 +977,20 @@ static char *preamble= "\
 #ifndef YY_RULE\n\
 #define YY_RULE(T)	static T\n\
 #endif\n\
+#ifndef YY_UNUSED\n\
+#ifdef __GNUC__\n\
+#define YY_UNUSED	__attribute__((unused))\n\
+#else\n\
+#define YY_UNUSED\n\
+#endif\n\
+#endif\n\
+#ifndef YY_UNLIKELY\n\
+#ifdef __GNUC__\n\
+#define YY_UNLIKELY(X)	__builtin_expect(!!(X), 0)\n\
+#else\n\
+#define YY_UNLIKELY(X)	(X)\n\
+#endif\n\
+#endif\n\
 #ifndef YY_PARSE\n\
 #define YY_PARSE(T)	T\n\
 #endif\n\
@@ -474,38 +1000,344 @@ static char *preamble= "\
 #ifndef YYPARSEFROM\n\
 #define YYPARSEFROM	yyparsefrom\n\
 #endif\n\
+#ifndef YYFIND\n\
+#define YYFIND		yyfind\n\
+#endif\n\
+#ifndef YYPARSEMANY\n\
+#define YYPARSEMANY	yyparse_many\n\
+#endif\n\
+#ifndef YYPARSEMANYFROM\n\
+#define YYPARSEMANYFROM	yyparse_many_from\n\
+#endif\n\
 #ifndef YYRELEASE\n\
 #define YYRELEASE	yyrelease\n\
 #endif\n\
-#ifndef YY_BEGIN\n\
-#define YY_BEGIN	( yy->__begin= yy->__pos, 1)\n\
+#ifndef YYCREATE\n\
+#define YYCREATE	yycreate\n\
 #endif\n\
-#ifndef YY_END\n\
-#define YY_END		( yy->__end= yy->__pos, 1)\n\
+#ifndef YYRESET\n\
+#define YYRESET		yyreset\n\
 #endif\n\
-#ifdef YY_DEBUG\n\
-# define yyprintf(args)	fprintf args\n\
-const char *__yyindentspaces = \"                                              \";\n\
-#else\n\
-# define yyprintf(args)\n\
+#ifndef YYACQUIRE\n\
+#define YYACQUIRE	yyacquire\n\
 #endif\n\
-#ifndef YYSTYPE\n\
-#define YYSTYPE	int\n\
+#ifndef YYRECYCLE\n\
+#define YYRECYCLE	yyrecycle\n\
 #endif\n\
-#ifndef YY_STACK_SIZE\n\
-#define YY_STACK_SIZE 128\n\
+#ifndef YYDRAIN\n\
+#define YYDRAIN		yydrain\n\
+#endif\n\
+#ifndef YYPARSEPARALLEL\n\
+#define YYPARSEPARALLEL	yyparse_parallel\n\
+#endif\n\
+#ifndef YYAST\n\
+#define YYAST		yyast\n\
+#endif\n\
+#ifndef YYHEATMAP\n\
+#define YYHEATMAP	yyheatmap\n\
+#endif\n\
+#ifndef YYPIPELINESTART\n\
+#define YYPIPELINESTART	yypipeline_start\n\
+#endif\n\
+#ifndef YYPIPELINEFINISH\n\
+#define YYPIPELINEFINISH	yypipeline_finish\n\
+#endif\n\
+#ifdef YY_EVENTS\n\
+#ifndef YY_RULE_ENTER\n\
+#define YY_RULE_ENTER(yy, rule, begin)\n\
+#endif\n\
+#ifndef YY_RULE_EXIT\n\
+#define YY_RULE_EXIT(yy, rule, begin, end)\n\
+#endif\n\
+#endif\n\
+#ifdef YY_PROBES\n\
+#if !defined(YY_PROBE_RULE_ENTER) && defined(__has_include)\n\
+#if __has_include(<sys/sdt.h>)\n\
+#include <sys/sdt.h>\n\
+#endif\n\
+#endif\n\
+#ifndef YY_PROBE_PROVIDER\n\
+#define YY_PROBE_PROVIDER	peg\n\
+#endif\n\
+#ifdef DTRACE_PROBE4\n\
+#ifndef YY_PROBE_RULE_ENTER\n\
+#define YY_PROBE_RULE_ENTER(yy, rule, pos)		DTRACE_PROBE3(YY_PROBE_PROVIDER, rule__enter, rule, pos, yyrulenames[rule])\n\
+#endif\n\
+#ifndef YY_PROBE_RULE_EXIT\n\
+#define YY_PROBE_RULE_EXIT(yy, rule, pos, ok)		DTRACE_PROBE4(YY_PROBE_PROVIDER, rule__exit, rule, pos, ok, yyrulenames[rule])\n\
+#endif\n\
+#ifndef YY_PROBE_REFILL\n\
+#define YY_PROBE_REFILL(yy, pos, length)		DTRACE_PROBE2(YY_PROBE_PROVIDER, refill, pos, length)\n\
+#endif\n\
+#ifndef YY_PROBE_COMMIT\n\
+#define YY_PROBE_COMMIT(yy, pos, kept)		DTRACE_PROBE2(YY_PROBE_PROVIDER, commit, pos, kept)\n\
+#endif\n\
+#ifndef YY_PROBE_ACTION\n\
+#define YY_PROBE_ACTION(yy, action, begin, end)	DTRACE_PROBE3(YY_PROBE_PROVIDER, action, action, begin, end)\n\
+#endif\n\
+#endif\n\
+#ifndef YY_PROBE_RULE_ENTER\n\
+#define YY_PROBE_RULE_ENTER(yy, rule, pos)\n\
+#endif\n\
+#ifndef YY_PROBE_RULE_EXIT\n\
+#define YY_PROBE_RULE_EXIT(yy, rule, pos, ok)\n\
+#endif\n\
+#ifndef YY_PROBE_REFILL\n\
+#define YY_PROBE_REFILL(yy, pos, length)\n\
+#endif\n\
+#ifndef YY_PROBE_COMMIT\n\
+#define YY_PROBE_COMMIT(yy, pos, kept)\n\
+#endif\n\
+#ifndef YY_PROBE_ACTION\n\
+#define YY_PROBE_ACTION(yy, action, begin, end)\n\
+#endif\n\
+#endif\n\
+#if defined(YY_FIND) && !defined(YY_FOUND)\n\
+#define YY_FOUND(yy, begin, end)\n\
+#endif\n\
+#ifndef YY_BEGIN\n\
+#define YY_BEGIN	( yy->__begin= yy->__pos, 1)\n\
+#endif\n\
+#ifndef YY_END\n\
+#ifdef YY_AST\n\
+#define YY_END		( yy->__end= yy->__pos, yyDo(yy, yyAstCapture, yy->__begin, yy->__end), 1)\n\
+#else\n\
+#define YY_END		( yy->__end= yy->__pos, 1)\n\
+#endif\n\
+#endif\n\
+#ifdef YY_DEBUG\n\
+# define yyDebugging(yy)	((yy)->__debugactive && (yy)->__base + (yy)->__pos >= (yy)->__debugfrom && (!(yy)->__debugto || (yy)->__base + (yy)->__pos < (yy)->__debugto))\n\
+# define yyprintf(args)	do { if (yyDebugging(yy)) fprintf args; } while (0)\n\
+# define yyDebugEnter(yy, rule)	(++(yy)->__calldepth, (yy)->__debugactive += (yy)->__debugrules[rule])\n\
+# define yyDebugLeave(yy, rule)	(--(yy)->__calldepth, (yy)->__debugactive -= (yy)->__debugrules[rule])\n\
+static const char __yyindentspaces[]= \"                                              \";\n\
+#else\n\
+# define yyprintf(args)\n\
+# define yyDebugEnter(yy, rule)\n\
+# define yyDebugLeave(yy, rule)\n\
+#endif\n\
+#ifndef YYSTYPE\n\
+#define YYSTYPE	int\n\
+#endif\n\
+#ifndef YY_STACK_SIZE\n\
+#define YY_STACK_SIZE 128\n\
+#endif\n\
+\n\
+#ifndef YY_BUFFER_SIZE\n\
+#define YY_BUFFER_SIZE 1024\n\
+#endif\n\
+\n\
+#ifndef YY_BATCH_SIZE\n\
+#define YY_BATCH_SIZE 64\n\
+#endif\n\
+\n\
+#ifndef YY_RESET_LIMIT\n\
+#define YY_RESET_LIMIT 65536\n\
+#endif\n\
+\n\
+#ifdef YY_ARENA\n\
+#ifndef YY_ARENA_SIZE\n\
+#define YY_ARENA_SIZE 4096\n\
+#endif\n\
+#ifndef YY_ARENA_ALIGN\n\
+#define YY_ARENA_ALIGN 16\n\
+#endif\n\
+#define YYALLOC(N)	yyArenaAlloc(yy, (N))\n\
+#define YYSTRDUP(S)	yyArenaStrdup(yy, (S))\n\
+#endif\n\
+\n\
+#if defined(YY_PARALLEL) || defined(YY_PIPELINE)\n\
+#include <pthread.h>\n\
+#endif\n\
+#if defined(YY_SAMPLER) && !defined(YY_RULE_STACK)\n\
+#define YY_RULE_STACK 1\n\
+#endif\n\
+#ifdef YY_RULE_STACK\n\
+#ifndef YY_RULE_STACK_SIZE\n\
+#define YY_RULE_STACK_SIZE	256\n\
+#endif\n\
+#define yyStackPush(yy, rule)	do { if (yy->__stackdepth < YY_RULE_STACK_SIZE) yy->__stack[yy->__stackdepth]= (rule);  ++yy->__stackdepth; } while (0)\n\
+#define yyStackPop(yy)		--yy->__stackdepth\n\
+#endif\n\
+#ifdef YY_SAMPLER\n\
+#include <signal.h>\n\
+#include <sys/time.h>\n\
+#ifndef YY_SAMPLER_SIZE\n\
+#define YY_SAMPLER_SIZE	(1 << 18)\n\
+#endif\n\
+#endif\n\
+#ifdef YY_PIPELINE\n\
+#ifndef YY_PIPELINE_DEPTH\n\
+#define YY_PIPELINE_DEPTH 16\n\
+#endif\n\
+#endif\n\
+#ifdef YY_PARALLEL\n\
+#ifndef YY_PARALLEL_CHUNKS\n\
+#define YY_PARALLEL_CHUNKS 4\n\
 #endif\n\
-\n\
-#ifndef YY_BUFFER_SIZE\n\
-#define YY_BUFFER_SIZE 1024\n\
 #endif\n\
 \n\
-#ifndef YY_PART\n\
-\n\
-typedef struct _yycontext yycontext;\n\
-typedef void (*yyaction)(yycontext *yy, char *yytext, int yyleng);\n\
-typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;\n\
-\n\
+#ifdef YY_BUDGET\n\
+#ifndef YY_BUDGET_CLOCK\n\
+#ifdef _WIN32\n\
+#include <windows.h>\n\
+#else\n\
+#include <time.h>\n\
+#endif\n\
+#define YY_BUDGET_CLOCK()	yyBudgetClock()\n\
+#define YY_BUDGET_CLOCK_DEFAULT 1\n\
+#endif\n\
+#ifndef YY_BUDGET_INTERVAL\n\
+#define YY_BUDGET_INTERVAL 1024\n\
+#endif\n\
+#endif\n\
+#ifdef YY_RULES_PROFILE\n\
+#ifndef YY_PROFILE_CLOCK\n\
+#if defined(YY_PROFILE_RDTSC) && (defined(__x86_64__) || defined(__i386__))\n\
+#include <x86intrin.h>\n\
+#define YY_PROFILE_CLOCK()	__rdtsc()\n\
+#define YY_PROFILE_UNIT		\"cycles\"\n\
+#else\n\
+#include <time.h>\n\
+#define YY_PROFILE_CLOCK()	yyProfileClock()\n\
+#define YY_PROFILE_UNIT		\"ns\"\n\
+#define YY_PROFILE_CLOCK_GETTIME 1\n\
+#endif\n\
+#endif\n\
+#ifndef YY_PROFILE_UNIT\n\
+#define YY_PROFILE_UNIT		\"ticks\"\n\
+#endif\n\
+#endif\n\
+#if defined(YY_RULES_PROFILE) && !defined(YY_VM)\n\
+#define yyReach(yy)	if (yy->__pos > yy->__alt_reach) yy->__alt_reach= yy->__pos\n\
+#define YY_ALT_TRY(alt)		++yy->__alt_tries[alt];  int yyreach##alt= yy->__alt_reach;  yy->__alt_reach= yy->__pos\n\
+#define YY_ALT_HIT(alt)		++yy->__alt_hits[alt];  if (yyreach##alt > yy->__alt_reach) yy->__alt_reach= yyreach##alt\n\
+#define YY_ALT_MISS(alt, pos)	yy->__alt_waste[alt] += yy->__alt_reach - (pos);  if (yyreach##alt > yy->__alt_reach) yy->__alt_reach= yyreach##alt\n\
+#else\n\
+#define yyReach(yy)\n\
+#define YY_ALT_TRY(alt)\n\
+#define YY_ALT_HIT(alt)\n\
+#define YY_ALT_MISS(alt, pos)\n\
+#endif\n\
+#ifdef YY_HEATMAP\n\
+#define YY_HEAT(yy, pos)	yyHeat(yy, pos)\n\
+#else\n\
+#define YY_HEAT(yy, pos)\n\
+#endif\n\
+#ifdef YY_TRACE\n\
+#ifndef YY_TRACE_SIZE\n\
+#define YY_TRACE_SIZE	1024\n\
+#endif\n\
+#define YY_TRACE_ENTER	0\n\
+#define YY_TRACE_OK	1\n\
+#define YY_TRACE_FAIL	2\n\
+#endif\n\
+#if defined(YY_BUDGET) || defined(YY_MAX_DEPTH)\n\
+#define YY_ABORT_BUDGET	1\n\
+#define YY_ABORT_CANCEL	2\n\
+#define YY_ABORT_DEPTH	3\n\
+#endif\n\
+/* Every rule begins with YY_RULE_PROLOGUE, after saving its start\n\
+ * position, and ends with YY_RULE_EPILOGUE on both its success (ok= 1)\n\
+ * and failure (ok= 0) paths.  Each part is empty unless its feature is\n\
+ * enabled.\n\
+ */\n\
+#ifdef YY_BUDGET\n\
+#define yyRuleBudget(yy)			if (yyBudget(yy)) return 0;\n\
+#else\n\
+#define yyRuleBudget(yy)\n\
+#endif\n\
+#ifdef YY_MAX_DEPTH\n\
+#define yyRuleDepthEnter(yy)			if (yyDepth(yy)) return 0;\n\
+#define yyRuleDepthLeave(yy)			--yy->__depth;\n\
+#else\n\
+#define yyRuleDepthEnter(yy)\n\
+#define yyRuleDepthLeave(yy)\n\
+#endif\n\
+#ifdef YY_RULES_PROFILE\n\
+#define yyRuleProfileEnter(yy, rule)		yyprofile yyprof;  yyProfileEnter(yy, rule, &yyprof);\n\
+#define yyRuleProfileLeave(yy, rule, ok)	++((ok) ? yy->__rules_succeed_count : yy->__rules_fail_count)[rule];  yyProfileLeave(yy, rule, &yyprof);\n\
+#else\n\
+#define yyRuleProfileEnter(yy, rule)\n\
+#define yyRuleProfileLeave(yy, rule, ok)\n\
+#endif\n\
+#ifdef YY_TRACE\n\
+#define yyRuleTraceEnter(yy, rule)		yyTrace(yy, YY_TRACE_ENTER, rule);\n\
+#define yyRuleTraceLeave(yy, rule, ok)		yyTrace(yy, (ok) ? YY_TRACE_OK : YY_TRACE_FAIL, rule);\n\
+#else\n\
+#define yyRuleTraceEnter(yy, rule)\n\
+#define yyRuleTraceLeave(yy, rule, ok)\n\
+#endif\n\
+#ifdef YY_PROBES\n\
+#define yyRuleProbeEnter(yy, rule)		YY_PROBE_RULE_ENTER(yy, rule, yy->__base + yy->__pos);\n\
+#define yyRuleProbeLeave(yy, rule, ok)		YY_PROBE_RULE_EXIT(yy, rule, yy->__base + yy->__pos, ok);\n\
+#else\n\
+#define yyRuleProbeEnter(yy, rule)\n\
+#define yyRuleProbeLeave(yy, rule, ok)\n\
+#endif\n\
+#ifdef YY_RULE_STACK\n\
+#define yyRuleStackEnter(yy, rule)		yyStackPush(yy, rule);\n\
+#define yyRuleStackLeave(yy)			yyStackPop(yy);\n\
+#else\n\
+#define yyRuleStackEnter(yy, rule)\n\
+#define yyRuleStackLeave(yy)\n\
+#endif\n\
+#ifdef YY_EVENTS\n\
+#define yyRuleEventsEnter(yy, rule)		int yyevent= yy->__thunkpos;  yyDo(yy, yyEventEnter, yy->__pos, rule);\n\
+#define yyRuleEventsLeave(yy, ok)		if (ok) yyDo(yy, yyEventLeave, yy->__pos, yyevent);\n\
+#else\n\
+#define yyRuleEventsEnter(yy, rule)\n\
+#define yyRuleEventsLeave(yy, ok)\n\
+#endif\n\
+#ifdef YY_AST\n\
+#define yyRuleAstEnter(yy, rule)		yyDo(yy, yyAstEnter, yy->__pos, rule);\n\
+#define yyRuleAstLeave(yy, ok)			if (ok) yyDo(yy, yyAstLeave, yy->__pos, 0);\n\
+#else\n\
+#define yyRuleAstEnter(yy, rule)\n\
+#define yyRuleAstLeave(yy, ok)\n\
+#endif\n\
+#ifdef YY_DEBUG\n\
+#define yyRuleDebugEnter(yy, rule)		yyDebugEnter(yy, rule);  yyprintf((stderr, \"%*.s%s\\n\", yy->__calldepth - 1, __yyindentspaces, yyrulenames[rule]));\n\
+#define yyRuleDebugLeave(yy, rule, pos, ok)	yyprintf((stderr, \"%*.s  %s %s @%d:%d %s\\n\", yy->__calldepth, __yyindentspaces, (ok) ? \"ok  \" : \"fail\", yyrulenames[rule], yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+(pos)));  yyDebugLeave(yy, rule);\n\
+#else\n\
+#define yyRuleDebugEnter(yy, rule)\n\
+#define yyRuleDebugLeave(yy, rule, pos, ok)\n\
+#endif\n\
+#define YY_RULE_PROLOGUE(yy, rule)	\\\n\
+  yyRuleBudget(yy) yyRuleDepthEnter(yy) yyRuleProfileEnter(yy, rule) yyRuleTraceEnter(yy, rule) yyRuleProbeEnter(yy, rule)	\\\n\
+  yyRuleStackEnter(yy, rule) yyRuleEventsEnter(yy, rule) yyRuleAstEnter(yy, rule) yyRuleDebugEnter(yy, rule)\n\
+#define YY_RULE_EPILOGUE(yy, rule, pos, ok)	\\\n\
+  yyRuleProfileLeave(yy, rule, ok) yyRuleDebugLeave(yy, rule, pos, ok) yyRuleAstLeave(yy, ok) yyRuleEventsLeave(yy, ok)	\\\n\
+  yyRuleTraceLeave(yy, rule, ok) yyRuleProbeLeave(yy, rule, ok) yyRuleStackLeave(yy) yyRuleDepthLeave(yy)\n\
+\n\
+#ifndef YY_PART\n\
+\n\
+typedef struct _yycontext yycontext;\n\
+typedef void (*yyaction)(yycontext *yy, char *yytext, int yyleng);\n\
+typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;\n\
+#ifdef YY_AST\n\
+typedef struct _yynode { int rule, parent, size, begin, end; } yynode;\n\
+#endif\n\
+#ifdef YY_ARENA\n\
+typedef struct _yyblock { struct _yyblock *next;  size_t size, used;  char data[1]; } yyblock;\n\
+#endif\n\
+#ifdef YY_RULES_PROFILE\n\
+typedef unsigned long long yytime;\n\
+typedef unsigned long long yycount;\n\
+typedef struct _yyprofile { yytime start, child; } yyprofile;\n\
+#endif\n\
+#ifdef YY_TRACE\n\
+typedef struct _yytrace { int pos, depth, rule, kind; } yytrace;\n\
+#endif\n\
+#ifdef YY_VM\n\
+typedef struct _yyframe {\n\
+  int pc, pos, thunkpos, rule;\n\
+#ifdef YY_RULES_PROFILE\n\
+  yyprofile profile;\n\
+#endif\n\
+} yyframe;\n\
+#endif\n\
+\n\
 struct _yycontext {\n\
   char     *__buf;\n\
   int       __buflen;\n\
@@ -526,19 +1358,104 @@ struct _yycontext {\n\
   int       __inputpos;\n\
   int       __lineno;\n\
   int       __linenopos;\n\
+  int       __resident;\n\
+#ifdef YY_PIPELINE\n\
+  struct _yypipeline *__pipeline;\n\
+#endif\n\
+#ifdef YY_ARENA\n\
+  yyblock  *__arena;\n\
+  yyblock  *__arenacur;\n\
+#endif\n\
+#ifdef YY_AST\n\
+  yynode   *__ast;\n\
+  int       __astlen;\n\
+  int       __astcount;\n\
+  int       __astparent;\n\
+#endif\n\
+#if defined(YY_AST) || defined(YY_EVENTS) || defined(YY_FIND) || defined(YY_HEATMAP) || defined(YY_TRACE) || defined(YY_DEBUG) || defined(YY_PROBES)\n\
+  int       __base;\n\
+#endif\n\
+#ifdef YY_HEATMAP\n\
+  int      *__heat;\n\
+  char     *__heattext;\n\
+  int       __heatlen;\n\
+  int       __heatsize;\n\
+#endif\n\
+#ifdef YY_RULE_STACK\n\
+  volatile int __stack[YY_RULE_STACK_SIZE];\n\
+  volatile int __stackdepth;\n\
+#endif\n\
+#ifdef YY_SAMPLER\n\
+  int      *__samples;\n\
+  volatile int __sampleslen;\n\
+  volatile int __samplesdropped;\n\
+#endif\n\
+#ifdef YY_TRACE\n\
+  yytrace   __trace[YY_TRACE_SIZE];\n\
+  unsigned long long __tracecount;\n\
+  int       __tracedepth;\n\
+#endif\n\
 #ifdef YY_DEBUG\n\
   char      __escapeCharBuf[4];\n\
   int       __calldepth;\n\
+  char      __debugrules[YYRULECOUNT+1];\n\
+  int       __debugactive;\n\
+  int       __debugfrom;\n\
+  int       __debugto;\n\
+  int       __debugset;\n\
 #endif\n\
 #ifdef YY_CTX_MEMBERS\n\
   YY_CTX_MEMBERS\n\
 #endif\n\
 #ifdef YY_RULES_PROFILE\n\
-  int       __rules_succeed_count[YYRULECOUNT+1];\n\
-  int       __rules_fail_count[YYRULECOUNT+1];\n\
+  yycount   __rules_succeed_count[YYRULECOUNT+1];\n\
+  yycount   __rules_fail_count[YYRULECOUNT+1];\n\
+  int       __rules_active[YYRULECOUNT+1];\n\
+  yytime    __rules_self_time[YYRULECOUNT+1];\n\
+  yytime    __rules_total_time[YYRULECOUNT+1];\n\
+  yytime    __rules_child;\n\
+  yycount   __rules_input;\n\
+#ifndef YY_VM\n\
+  yycount   __alt_tries[YYALTCOUNT+1];\n\
+  yycount   __alt_hits[YYALTCOUNT+1];\n\
+  yycount   __alt_waste[YYALTCOUNT+1];\n\
+  int       __alt_reach;\n\
+#endif\n\
+#endif\n\
+#if defined(YY_BUDGET) || defined(YY_MAX_DEPTH)\n\
+  int       __abort;\n\
+#endif\n\
+#ifdef YY_BUDGET\n\
+  long      __steps;\n\
+  long      __maxsteps;\n\
+  long long __maxclock;\n\
+  long long __deadline;\n\
+  volatile int *__cancel;\n\
+#endif\n\
+#ifdef YY_MAX_DEPTH\n\
+  int       __depth;\n\
+  int       __maxdepth;\n\
+#endif\n\
+#ifdef YY_VM\n\
+  yyframe  *__frames;\n\
+  int       __frameslen;\n\
+  int       __framepos;\n\
 #endif\n\
 };\n\
 \n\
+#if defined(YY_POOL) && defined(YY_CTX_LOCAL)\n\
+#ifndef YY_POOL_SIZE\n\
+#define YY_POOL_SIZE 64\n\
+#endif\n\
+typedef struct _yypool {\n\
+  yycontext *__contexts[YY_POOL_SIZE];\n\
+  int        __buflen;\n\
+  int        __textlen;\n\
+  int        __thunkslen;\n\
+  int        __valslen;\n\
+} yypool;\n\
+#endif\n\
+\n\
 #ifdef YY_DEBUG\n\
 YY_LOCAL(const char *) yyescapedChar(yycontext *yy, int ch)\n\
 {\n\
@@ -599,9 +1516,212 @@ yycontext *yyctx= &_yyctx;\n\
 #endif\n\
 #endif\n\
 \n\
+#ifdef YY_RULES_PROFILE\n\
+#ifdef YY_PROFILE_CLOCK_GETTIME\n\
+YY_LOCAL(yytime) yyProfileClock(void)\n\
+{\n\
+  struct timespec ts;\n\
+  clock_gettime(CLOCK_MONOTONIC, &ts);\n\
+  return (yytime)ts.tv_sec * 1000000000 + ts.tv_nsec;\n\
+}\n\
+#endif\n\
+\n\
+YY_LOCAL(void) yyProfileEnter(yycontext *yy, int rule, yyprofile *p)\n\
+{\n\
+  p->child= yy->__rules_child;\n\
+  yy->__rules_child= 0;\n\
+  ++yy->__rules_active[rule];\n\
+  p->start= YY_PROFILE_CLOCK();\n\
+}\n\
+\n\
+YY_LOCAL(void) yyProfileLeave(yycontext *yy, int rule, yyprofile *p)\n\
+{\n\
+  yytime elapsed= YY_PROFILE_CLOCK() - p->start;\n\
+  yy->__rules_self_time[rule] += elapsed - yy->__rules_child;\n\
+  if (!--yy->__rules_active[rule])\n\
+    yy->__rules_total_time[rule] += elapsed;\n\
+  yy->__rules_child= p->child + elapsed;\n\
+}\n\
+#endif\n\
+\n\
+#ifdef YY_BUDGET\n\
+#ifdef YY_BUDGET_CLOCK_DEFAULT\n\
+YY_LOCAL(long long) yyBudgetClock(void)\n\
+{\n\
+#ifdef _WIN32\n\
+  LARGE_INTEGER freq, now;\n\
+  QueryPerformanceFrequency(&freq);\n\
+  QueryPerformanceCounter(&now);\n\
+  return now.QuadPart / freq.QuadPart * 1000000 + now.QuadPart % freq.QuadPart * 1000000 / freq.QuadPart;\n\
+#else\n\
+  struct timespec ts;\n\
+  clock_gettime(CLOCK_MONOTONIC, &ts);\n\
+  return (long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;\n\
+#endif\n\
+}\n\
+#endif\n\
+\n\
+YY_LOCAL(int) yyBudget(yycontext *yy)\n\
+{\n\
+  if (yy->__abort) return 1;\n\
+  ++yy->__steps;\n\
+  if (yy->__maxsteps && yy->__steps > yy->__maxsteps)\n\
+    yy->__abort= YY_ABORT_BUDGET;\n\
+  else if (!(yy->__steps % YY_BUDGET_INTERVAL))\n\
+    {\n\
+      if (yy->__cancel && *yy->__cancel)\n\
+        yy->__abort= YY_ABORT_CANCEL;\n\
+      else if (yy->__deadline && YY_BUDGET_CLOCK() > yy->__deadline)\n\
+        yy->__abort= YY_ABORT_BUDGET;\n\
+    }\n\
+  return yy->__abort;\n\
+}\n\
+#endif\n\
+\n\
+#ifdef YY_MAX_DEPTH\n\
+YY_LOCAL(int) yyDepth(yycontext *yy)\n\
+{\n\
+  if (yy->__abort) return 1;\n\
+  if (yy->__depth >= (yy->__maxdepth ? yy->__maxdepth : YY_MAX_DEPTH))\n\
+    {\n\
+      yy->__abort= YY_ABORT_DEPTH;\n\
+      return 1;\n\
+    }\n\
+  ++yy->__depth;\n\
+  return 0;\n\
+}\n\
+#endif\n\
+\n\
+#ifdef YY_ARENA\n\
+YY_LOCAL(void *) yyArenaAlloc(yycontext *yy, size_t size)\n\
+{\n\
+  yyblock *b= yy->__arenacur;\n\
+  char *p;\n\
+  for (;;)\n\
+    {\n\
+      if (b)\n\
+        {\n\
+          p= (char *)(((size_t)(b->data + b->used) + YY_ARENA_ALIGN - 1) & ~(size_t)(YY_ARENA_ALIGN - 1));\n\
+          if (p + size <= b->data + b->size)\n\
+            {\n\
+              b->used= p + size - b->data;\n\
+              yy->__arenacur= b;\n\
+              return p;\n\
+            }\n\
+          if (b->next)\n\
+            {\n\
+              b= b->next;\n\
+              continue;\n\
+            }\n\
+        }\n\
+      {\n\
+        size_t n= size + YY_ARENA_ALIGN > YY_ARENA_SIZE ? size + YY_ARENA_ALIGN : YY_ARENA_SIZE;\n\
+        yyblock *nb= (yyblock *)YY_MALLOC(yy, sizeof(yyblock) + n);\n\
+        nb->next= 0;\n\
+        nb->size= n;\n\
+        nb->used= 0;\n\
+        if (b) b->next= nb; else yy->__arena= nb;\n\
+        b= nb;\n\
+      }\n\
+    }\n\
+}\n\
+\n\
+YY_UNUSED YY_LOCAL(char *) yyArenaStrdup(yycontext *yy, const char *s)\n\
+{\n\
+  size_t n= strlen(s) + 1;\n\
+  return (char *)memcpy(yyArenaAlloc(yy, n), s, n);\n\
+}\n\
+\n\
+YY_LOCAL(void) yyArenaReset(yycontext *yy, size_t keep)\n\
+{\n\
+  yyblock *b= yy->__arena, **link= &yy->__arena;\n\
+  size_t total= 0;\n\
+  while (b)\n\
+    {\n\
+      yyblock *next= b->next;\n\
+      if (total + b->size <= keep)\n\
+        {\n\
+          total += b->size;\n\
+          b->used= 0;\n\
+          *link= b;\n\
+          link= &b->next;\n\
+        }\n\
+      else\n\
+        YY_FREE(yy, b);\n\
+      b= next;\n\
+    }\n\
+  *link= 0;\n\
+  yy->__arenacur= yy->__arena;\n\
+}\n\
+#endif\n\
+\n\
+#ifdef YY_HEATMAP\n\
+YY_LOCAL(void) yyHeatInput(yycontext *yy, int from, int length)\n\
+{\n\
+  int offset= yy->__base + from;\n\
+  if (offset + length > yy->__heatsize)\n\
+    {\n\
+      int size= yy->__heatsize ? yy->__heatsize : YY_BUFFER_SIZE;\n\
+      while (size < offset + length) size *= 2;\n\
+      yy->__heat= (int *)YY_REALLOC(yy, yy->__heat, sizeof(int) * size);\n\
+      yy->__heattext= (char *)YY_REALLOC(yy, yy->__heattext, size);\n\
+      yy->__heatsize= size;\n\
+    }\n\
+  memset(yy->__heat + offset, 0, sizeof(int) * length);\n\
+  memcpy(yy->__heattext + offset, yy->__buf + from, length);\n\
+  yy->__heatlen= offset + length;\n\
+}\n\
+\n\
+YY_LOCAL(void) yyHeat(yycontext *yy, int pos)\n\
+{\n\
+  int i= yy->__base + pos, e= yy->__base + yy->__pos;\n\
+  if (e > yy->__heatlen) e= yy->__heatlen;\n\
+  while (i < e) ++yy->__heat[i++];\n\
+}\n\
+#endif\n\
+\n\
+#ifdef YY_RULE_STACK\n\
+YY_PARSE(int) yyShowRuleStack(yycontext *yy, FILE *fp);\n\
+#endif\n\
+\n\
+#ifdef YY_SAMPLER\n\
+YY_PARSE(void) yyStopSampler(yycontext *yy);\n\
+\n\
+static yycontext *yysampled= 0;	/* the one context being sampled */\n\
+\n\
+YY_LOCAL(void) yySampleSignal(int sig)\n\
+{\n\
+  yycontext *yy= yysampled;\n\
+  int depth, i;\n\
+  if (!yy || !(depth= yy->__stackdepth)) return;\n\
+  if (depth > YY_RULE_STACK_SIZE) depth= YY_RULE_STACK_SIZE;\n\
+  if (yy->__sampleslen + depth + 1 > YY_SAMPLER_SIZE)\n\
+    {\n\
+      ++yy->__samplesdropped;\n\
+      return;\n\
+    }\n\
+  yy->__samples[yy->__sampleslen]= depth;\n\
+  for (i= 0;  i < depth;  ++i)\n\
+    yy->__samples[yy->__sampleslen + 1 + i]= yy->__stack[i];\n\
+  yy->__sampleslen += depth + 1;\n\
+}\n\
+#endif\n\
+\n\
+#ifdef YY_TRACE\n\
+YY_LOCAL(void) yyTrace(yycontext *yy, int kind, int rule)\n\
+{\n\
+  yytrace *t= &yy->__trace[yy->__tracecount++ % YY_TRACE_SIZE];\n\
+  t->pos= yy->__base + yy->__pos;\n\
+  t->depth= (YY_TRACE_ENTER == kind) ? yy->__tracedepth++ : --yy->__tracedepth;\n\
+  t->rule= rule;\n\
+  t->kind= kind;\n\
+}\n\
+#endif\n\
+\n\
 YY_LOCAL(int) yyrefill(yycontext *yy)\n\
 {\n\
   int yyn;\n\
+  if (yy->__resident) return 0;\n\
   while (yy->__buflen - yy->__pos < 512)\n\
     {\n\
 #ifdef YY_DEBUG\n\
@@ -621,6 +1741,15 @@ YY_LOCAL(int) yyrefill(yycontext *yy)\n\
 #endif\n\
   if (!yyn) return 0;\n\
   yy->__limit += yyn;\n\
+#ifdef YY_RULES_PROFILE\n\
+  yy->__rules_input += yyn;\n\
+#endif\n\
+#ifdef YY_HEATMAP\n\
+  yyHeatInput(yy, yy->__limit - yyn, yyn);\n\
+#endif\n\
+#ifdef YY_PROBES\n\
+  YY_PROBE_REFILL(yy, yy->__base + yy->__limit - yyn, yyn);\n\
+#endif\n\
   return 1;\n\
 }\n\
 \n\
@@ -628,6 +1757,7 @@ YY_LOCAL(int) yymatchDot(yycontext *yy)\n\
 {\n\
   if (yy->__pos >= yy->__limit && !yyrefill(yy)) return 0;\n\
   ++yy->__pos;\n\
+  yyReach(yy);\n\
   return 1;\n\
 }\n\
 \n\
@@ -637,6 +1767,7 @@ YY_LOCAL(int) yymatchChar(yycontext *yy, int c)\n\
   if ((unsigned char)yy->__buf[yy->__pos] == c)\n\
     {\n\
       ++yy->__pos;\n\
+      yyReach(yy);\n\
       yyprintf((stderr, \"%*.s  ok   yymatchChar(yy, %s) @%d:%d %s\\n\", yy->__calldepth, __yyindentspaces, yyescapedChar(yy, c), yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));\n\
       return 1;\n\
     }\n\
@@ -650,6 +1781,7 @@ YY_LOCAL(int) yymatchCharCaseInsensitive(yycontext *yy, int c)\n\
   if (tolower(yy->__buf[yy->__pos]) == tolower(c))\n\
     {\n\
       ++yy->__pos;\n\
+      yyReach(yy);\n\
       yyprintf((stderr, \"%*.s  ok   yymatchCharCaseInsensitive(yy, %s) @%d:%d %s\\n\", yy->__calldepth, __yyindentspaces, yyescapedChar(yy, c), yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));\n\
       return 1;\n\
     }\n\
@@ -671,6 +1803,7 @@ YY_LOCAL(int) yymatchString(yycontext *yy, const char *s)\n\
       ++s;\n\
       ++yy->__pos;\n\
     }\n\
+  yyReach(yy);\n\
   return 1;\n\
 }\n\
 \n\
@@ -688,6 +1821,7 @@ YY_LOCAL(int) yymatchStringCaseInsensitive(yycontext *yy, const char *s)\n\
       ++s;\n\
       ++yy->__pos;\n\
     }\n\
+  yyReach(yy);\n\
   return 1;\n\
 }\n\
 \n\
@@ -699,6 +1833,7 @@ YY_LOCAL(int) yymatchClass(yycontext *yy, unsigned char *bits)\n\
   if (bits[c >> 3] & (1 << (c & 7)))\n\
     {\n\
       ++yy->__pos;\n\
+      yyReach(yy);\n\
       yyprintf((stderr, \"%*.s  ok   yymatchClass @%d:%d %s\\n\", yy->__calldepth, __yyindentspaces, yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));\n\
       return 1;\n\
     }\n\
@@ -714,6 +1849,7 @@ YY_LOCAL(int) yymatchClassCaseInsensitive(yycontext *yy, unsigned char *bits)\n\
   if (bits[c >> 3] & (1 << (c & 7)))\n\
     {\n\
       ++yy->__pos;\n\
+      yyReach(yy);\n\
       yyprintf((stderr, \"%*.s  ok   yymatchClassCaseInsensitive @%d:%d %s\\n\", yy->__calldepth, __yyindentspaces, yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));\n\
       return 1;\n\
     }\n\
@@ -721,6 +1857,7 @@ YY_LOCAL(int) yymatchClassCaseInsensitive(yycontext *yy, unsigned char *bits)\n\
   return 0;\n\
 }\n\
 \n\
+#if !defined(YY_RECOGNIZER) || defined(YY_VM) || defined(YY_EVENTS) || defined(YY_AST)\n\
 YY_LOCAL(void) yyDo(yycontext *yy, yyaction action, int begin, int end)\n\
 {\n\
   while (yy->__thunkpos >= yy->__thunkslen)\n\
@@ -733,6 +1870,7 @@ YY_LOCAL(void) yyDo(yycontext *yy, yyaction action, int begin, int end)\n\
   yy->__thunks[yy->__thunkpos].action= action;\n\
   ++yy->__thunkpos;\n\
 }\n\
+#endif\n\
 \n\
 YY_LOCAL(int) yyText(yycontext *yy, int begin, int end)\n\
 {\n\
@@ -752,37 +1890,257 @@ YY_LOCAL(int) yyText(yycontext *yy, int begin, int end)\n\
   return yyleng;\n\
 }\n\
 \n\
-YY_LOCAL(void) yyDone(yycontext *yy)\n\
+#ifdef YY_PIPELINE\n\
+typedef struct _yyentry { yyaction action;  int text, leng; } yyentry;\n\
+\n\
+typedef struct _yybatch {\n\
+  yyentry  *__entries;\n\
+  int       __entrieslen;\n\
+  int       __count;\n\
+  char     *__text;\n\
+  int       __textlen;\n\
+  int       __textpos;\n\
+  int       __reset;\n\
+} yybatch;\n\
+\n\
+typedef struct _yypipeline {\n\
+  yycontext *__ctx;\n\
+  pthread_t  __consumer;\n\
+  yybatch   *__full[YY_PIPELINE_DEPTH];\n\
+  unsigned   __fullhead, __fulltail;\n\
+  yybatch   *__free[YY_PIPELINE_DEPTH];\n\
+  unsigned   __freehead, __freetail;\n\
+  yybatch   *__batches[YY_PIPELINE_DEPTH];\n\
+  int        __count;\n\
+  int        __reset;\n\
+  int        __stop;\n\
+  pthread_mutex_t __lock;\n\
+  pthread_cond_t  __fullcond, __freecond;\n\
+} yypipeline;\n\
+\n\
+YY_LOCAL(void) yyPipelinePut(yypipeline *p, yybatch **ring, unsigned *tail, pthread_cond_t *cond, yybatch *batch)\n\
 {\n\
-  int pos;\n\
+  pthread_mutex_lock(&p->__lock);\n\
+  ring[*tail % YY_PIPELINE_DEPTH]= batch;\n\
+  ++*tail;\n\
+  pthread_cond_signal(cond);\n\
+  pthread_mutex_unlock(&p->__lock);\n\
+}\n\
+\n\
+/* take the next batch from ring; if wait, block until one arrives or the pipeline stops */\n\
+YY_LOCAL(yybatch *) yyPipelineGet(yypipeline *p, yybatch **ring, unsigned *head, unsigned *tail, pthread_cond_t *cond, int wait)\n\
+{\n\
+  yybatch *batch= 0;\n\
+  pthread_mutex_lock(&p->__lock);\n\
+  while (wait && *head == *tail && !p->__stop)\n\
+    pthread_cond_wait(cond, &p->__lock);\n\
+  if (*head != *tail)\n\
+    batch= ring[(*head)++ % YY_PIPELINE_DEPTH];\n\
+  pthread_mutex_unlock(&p->__lock);\n\
+  return batch;\n\
+}\n\
+\n\
+#ifdef YY_AST\n\
+YY_LOCAL(int) yyAstThunk(yycontext *yy, yythunk *thunk);\n\
+#endif\n\
+#ifdef YY_EVENTS\n\
+YY_LOCAL(int) yyEventThunk(yycontext *yy, yythunk *thunk);\n\
+#endif\n\
+\n\
+YY_LOCAL(void) yyPipelineDone(yycontext *yy)\n\
+{\n\
+  yypipeline *p= yy->__pipeline;\n\
+  yybatch *b;\n\
+  int pos, count= 0;\n\
+  if (!(b= yyPipelineGet(p, p->__free, &p->__freehead, &p->__freetail, &p->__freecond, 0)))\n\
+    {\n\
+      if (p->__count < YY_PIPELINE_DEPTH)\n\
+        {\n\
+          b= p->__batches[p->__count++]= (yybatch *)YY_MALLOC(yy, sizeof(yybatch));\n\
+          b->__entrieslen= YY_STACK_SIZE;\n\
+          b->__entries= (yyentry *)YY_MALLOC(yy, sizeof(yyentry) * b->__entrieslen);\n\
+          b->__textlen= YY_BUFFER_SIZE;\n\
+          b->__text= (char *)YY_MALLOC(yy, b->__textlen);\n\
+        }\n\
+      else\n\
+        b= yyPipelineGet(p, p->__free, &p->__freehead, &p->__freetail, &p->__freecond, 1);\n\
+    }\n\
+  if (b->__entrieslen < yy->__thunkpos)\n\
+    {\n\
+      while (b->__entrieslen < yy->__thunkpos) b->__entrieslen *= 2;\n\
+      b->__entries= (yyentry *)YY_REALLOC(yy, b->__entries, sizeof(yyentry) * b->__entrieslen);\n\
+    }\n\
+  b->__textpos= 0;\n\
+  b->__reset= p->__reset;\n\
+  p->__reset= 0;\n\
   for (pos= 0;  pos < yy->__thunkpos;  ++pos)\n\
     {\n\
       yythunk *thunk= &yy->__thunks[pos];\n\
-      int yyleng= thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;\n\
-      yyprintf((stderr, \"DO [%d] %p %s\\n\", pos, thunk->action, yy->__text));\n\
-      thunk->action(yy, yy->__text, yyleng);\n\
+      yyentry *e;\n\
+      /* tree and event thunks hold a rule id in end: handle them here, not as text */\n\
+#ifdef YY_AST\n\
+      if (yyAstThunk(yy, thunk)) continue;\n\
+#endif\n\
+#ifdef YY_EVENTS\n\
+      if (yyEventThunk(yy, thunk)) continue;\n\
+#endif\n\
+      e= &b->__entries[count++];\n\
+      e->action= thunk->action;\n\
+      if (!thunk->end)\n\
+        {\n\
+          e->text= -1;\n\
+          e->leng= thunk->begin;\n\
+          continue;\n\
+        }\n\
+      e->leng= thunk->end > thunk->begin ? thunk->end - thunk->begin : 0;\n\
+      while (b->__textlen < b->__textpos + e->leng + 1)\n\
+        {\n\
+          b->__textlen *= 2;\n\
+          b->__text= (char *)YY_REALLOC(yy, b->__text, b->__textlen);\n\
+        }\n\
+      e->text= b->__textpos;\n\
+      memcpy(b->__text + b->__textpos, yy->__buf + thunk->begin, e->leng);\n\
+      b->__text[b->__textpos + e->leng]= '\\0';\n\
+      b->__textpos += e->leng + 1;\n\
     }\n\
+  b->__count= count;\n\
+  yyPipelinePut(p, p->__full, &p->__fulltail, &p->__fullcond, b);\n\
   yy->__thunkpos= 0;\n\
 }\n\
+#endif\n\
 \n\
-YY_LOCAL(void) yyCommit(yycontext *yy)\n\
+YY_LOCAL(void) yyValReset(yycontext *yy)\n\
 {\n\
-  if (yy->__pos > 0) {\n\
-    if ((yy->__limit -= yy->__pos)) {\n\
-      memmove(yy->__buf, yy->__buf + yy->__pos, yy->__limit);\n\
+#ifdef YY_PIPELINE\n\
+  if (yy->__pipeline)\n\
+    {\n\
+      yy->__pipeline->__reset= 1;\n\
+      return;\n\
     }\n\
-    yy->__begin -= yy->__pos;\n\
-    yy->__end -= yy->__pos;\n\
-    yy->__pos= 0;\n\
-  }\n\
-  yy->__thunkpos= 0;\n\
+#endif\n\
+  yy->__val= yy->__vals;\n\
 }\n\
 \n\
-YY_LOCAL(int) yyAccept(yycontext *yy, int tp0)\n\
+#ifdef YY_AST\n\
+YY_LOCAL(void) yyAstEnter(yycontext *yy, char *yytext, int yyleng)	{}\n\
+YY_LOCAL(void) yyAstLeave(yycontext *yy, char *yytext, int yyleng)	{}\n\
+YY_LOCAL(void) yyAstCapture(yycontext *yy, char *yytext, int yyleng)	{}\n\
+\n\
+YY_LOCAL(int) yyAstThunk(yycontext *yy, yythunk *thunk)\n\
 {\n\
-  if (tp0)\n\
+  yynode *node;\n\
+  if (thunk->action == yyAstLeave)\n\
     {\n\
-      fprintf(stderr, \"accept denied at %d\\n\", tp0);\n\
+      node= &yy->__ast[yy->__astparent];\n\
+      node->end= yy->__base + thunk->begin;\n\
+      node->size= yy->__astcount - yy->__astparent;\n\
+      yy->__astparent= node->parent;\n\
+      return 1;\n\
+    }\n\
+  if (thunk->action != yyAstEnter && thunk->action != yyAstCapture)\n\
+    return 0;\n\
+  if (yy->__astcount >= yy->__astlen)\n\
+    {\n\
+      yy->__astlen= yy->__astlen ? yy->__astlen * 2 : YY_STACK_SIZE;\n\
+      yy->__ast= (yynode *)YY_REALLOC(yy, yy->__ast, sizeof(yynode) * yy->__astlen);\n\
+    }\n\
+  node= &yy->__ast[yy->__astcount];\n\
+  node->parent= yy->__astparent;\n\
+  node->begin= yy->__base + thunk->begin;\n\
+  if (thunk->action == yyAstEnter)\n\
+    {\n\
+      node->rule= thunk->end;\n\
+      yy->__astparent= yy->__astcount;\n\
+    }\n\
+  else\n\
+    {\n\
+      node->rule= 0;\n\
+      node->size= 1;\n\
+      node->end= yy->__base + thunk->end;\n\
+    }\n\
+  ++yy->__astcount;\n\
+  return 1;\n\
+}\n\
+#endif\n\
+\n\
+#ifdef YY_EVENTS\n\
+static const char *const yyrulenames[YYRULECOUNT+1];\n\
+\n\
+YY_LOCAL(void) yyEventEnter(yycontext *yy, char *yytext, int yyleng)	{}\n\
+YY_LOCAL(void) yyEventLeave(yycontext *yy, char *yytext, int yyleng)	{}\n\
+\n\
+YY_LOCAL(int) yyEventThunk(yycontext *yy, yythunk *thunk)\n\
+{\n\
+  if (thunk->action == yyEventEnter)\n\
+    {\n\
+      YY_RULE_ENTER(yy, thunk->end, yy->__base + thunk->begin);\n\
+      return 1;\n\
+    }\n\
+  if (thunk->action == yyEventLeave)\n\
+    {\n\
+      yythunk *enter= &yy->__thunks[thunk->end];\n\
+      (void)enter;\n\
+      YY_RULE_EXIT(yy, enter->end, yy->__base + enter->begin, yy->__base + thunk->begin);\n\
+      return 1;\n\
+    }\n\
+  return 0;\n\
+}\n\
+#endif\n\
+\n\
+YY_LOCAL(void) yyDone(yycontext *yy)\n\
+{\n\
+  int pos;\n\
+#ifdef YY_PIPELINE\n\
+  if (yy->__pipeline)\n\
+    {\n\
+      yyPipelineDone(yy);\n\
+      return;\n\
+    }\n\
+#endif\n\
+  for (pos= 0;  pos < yy->__thunkpos;  ++pos)\n\
+    {\n\
+      yythunk *thunk= &yy->__thunks[pos];\n\
+      int yyleng;\n\
+#ifdef YY_AST\n\
+      if (yyAstThunk(yy, thunk)) continue;\n\
+#endif\n\
+#ifdef YY_EVENTS\n\
+      if (yyEventThunk(yy, thunk)) continue;\n\
+#endif\n\
+      yyleng= thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;\n\
+      yyprintf((stderr, \"DO [%d] %p %s\\n\", pos, thunk->action, yy->__text));\n\
+#ifdef YY_PROBES\n\
+      YY_PROBE_ACTION(yy, thunk->action, yy->__base + thunk->begin, yy->__base + thunk->end);\n\
+#endif\n\
+      thunk->action(yy, yy->__text, yyleng);\n\
+    }\n\
+  yy->__thunkpos= 0;\n\
+}\n\
+\n\
+YY_LOCAL(void) yyCommit(yycontext *yy)\n\
+{\n\
+  if (yy->__pos > 0) {\n\
+#if defined(YY_AST) || defined(YY_EVENTS) || defined(YY_FIND) || defined(YY_HEATMAP) || defined(YY_TRACE) || defined(YY_DEBUG) || defined(YY_PROBES)\n\
+    yy->__base += yy->__pos;\n\
+#endif\n\
+    if ((yy->__limit -= yy->__pos)) {\n\
+      memmove(yy->__buf, yy->__buf + yy->__pos, yy->__limit);\n\
+    }\n\
+#ifdef YY_PROBES\n\
+    YY_PROBE_COMMIT(yy, yy->__base, yy->__limit);\n\
+#endif\n\
+    yy->__begin -= yy->__pos;\n\
+    yy->__end -= yy->__pos;\n\
+    yy->__pos= 0;\n\
+  }\n\
+  yy->__thunkpos= 0;\n\
+}\n\
+\n\
+YY_UNUSED YY_LOCAL(int) yyAccept(yycontext *yy, int tp0)\n\
+{\n\
+  if (tp0)\n\
+    {\n\
+      fprintf(stderr, \"accept denied at %d\\n\", tp0);\n\
       return 0;\n\
     }\n\
   else\n\
@@ -793,6 +2151,7 @@ YY_LOCAL(int) yyAccept(yycontext *yy, int tp0)\n\
   return 1;\n\
 }\n\
 \n\
+#if !defined(YY_RECOGNIZER) || defined(YY_VM)\n\
 YY_LOCAL(void) yyPush(yycontext *yy, char *text, int count)\n\
 {\n\
   yy->__val += count;\n\
@@ -806,6 +2165,7 @@ YY_LOCAL(void) yyPush(yycontext *yy, char *text, int count)\n\
 }\n\
 YY_LOCAL(void) yyPop(yycontext *yy, char *text, int count)   { yy->__val -= count; }\n\
 YY_LOCAL(void) yySet(yycontext *yy, char *text, int count)   { yy->__val[count]= yy->__; }\n\
+#endif\n\
 \n\
 #endif /* YY_PART */\n\
 \n\
@@ -819,29 +2179,91 @@ static char *footer= "\n\
 \n\
 typedef int (*yyrule)(yycontext *yy);\n\
 \n\
-YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)\n\
+#ifdef YY_DEBUG\n\
+YY_PARSE(void) yyDebugFilter(yycontext *yy, const char *rules, int from, int to)\n\
 {\n\
-  int yyok;\n\
-  if (!yyctx->__buflen)\n\
+  int i;\n\
+  yy->__debugrules[0]= !rules;	/* tracing outside any rule */\n\
+  for (i= 1;  i <= YYRULECOUNT;  ++i)\n\
     {\n\
-      yyctx->__buflen= YY_BUFFER_SIZE;\n\
-      yyctx->__buf= (char *)YY_MALLOC(yyctx, yyctx->__buflen);\n\
-#ifdef YY_DEBUG\n\
-      memset(yyctx->__buf, 0, yyctx->__buflen);\n\
+      const char *p= rules;\n\
+      size_t n= strlen(yyrulenames[i]);\n\
+      yy->__debugrules[i]= 0;\n\
+      for (;  p && (p= strstr(p, yyrulenames[i]));  p += n)\n\
+	if ((p == rules || strchr(\", \\t\", p[-1])) && strchr(\", \\t\", p[n]))\n\
+	  {\n\
+	    yy->__debugrules[i]= 1;\n\
+	    break;\n\
+	  }\n\
+    }\n\
+  yy->__debugactive= yy->__debugrules[0];\n\
+  yy->__debugfrom= from;\n\
+  yy->__debugto= to;\n\
+  yy->__debugset= 1;\n\
+}\n\
 #endif\n\
-      yyctx->__textlen= YY_BUFFER_SIZE;\n\
-      yyctx->__text= (char *)YY_MALLOC(yyctx, yyctx->__textlen);\n\
-      yyctx->__thunkslen= YY_STACK_SIZE;\n\
-      yyctx->__thunks= (yythunk *)YY_MALLOC(yyctx, sizeof(yythunk) * yyctx->__thunkslen);\n\
-      yyctx->__valslen= YY_STACK_SIZE;\n\
-      yyctx->__vals= (YYSTYPE *)YY_MALLOC(yyctx, sizeof(YYSTYPE) * yyctx->__valslen);\n\
-      yyctx->__begin= yyctx->__end= yyctx->__pos= yyctx->__limit= yyctx->__thunkpos= 0;\n\
+\n\
+YY_LOCAL(void) yyInit(yycontext *yy)\n\
+{\n\
+  yy->__buflen= YY_BUFFER_SIZE;\n\
+  yy->__buf= (char *)YY_MALLOC(yy, yy->__buflen);\n\
+#ifdef YY_DEBUG\n\
+  memset(yy->__buf, 0, yy->__buflen);\n\
+  if (!yy->__debugset)\n\
+    {\n\
+      const char *range= getenv(\"YY_DEBUG_RANGE\");\n\
+      int from= 0, to= 0;\n\
+      if (range) sscanf(range, \"%%d-%%d\", &from, &to);\n\
+      yyDebugFilter(yy, getenv(\"YY_DEBUG_RULES\"), from, to);\n\
     }\n\
-  yyctx->__begin= yyctx->__end= yyctx->__pos;\n\
+#endif\n\
+  yy->__textlen= YY_BUFFER_SIZE;\n\
+  yy->__text= (char *)YY_MALLOC(yy, yy->__textlen);\n\
+#if !defined(YY_RECOGNIZER) || defined(YY_EVENTS) || defined(YY_AST)\n\
+  yy->__thunkslen= YY_STACK_SIZE;\n\
+  yy->__thunks= (yythunk *)YY_MALLOC(yy, sizeof(yythunk) * yy->__thunkslen);\n\
+#endif\n\
+#ifndef YY_RECOGNIZER\n\
+  yy->__valslen= YY_STACK_SIZE;\n\
+  yy->__vals= (YYSTYPE *)YY_MALLOC(yy, sizeof(YYSTYPE) * yy->__valslen);\n\
+#endif\n\
+  yy->__begin= yy->__end= yy->__pos= yy->__limit= yy->__thunkpos= 0;\n\
+}\n\
+\n\
+YY_LOCAL(int) yyMatch(yycontext *yy, yyrule yystart)\n\
+{\n\
+  int yyok;\n\
+  yy->__begin= yy->__end= yy->__pos;\n\
+  yyValReset(yy);\n\
+#if defined(YY_BUDGET) || defined(YY_MAX_DEPTH)\n\
+  yy->__abort= 0;\n\
+#endif\n\
+#ifdef YY_BUDGET\n\
+  yy->__steps= 0;\n\
+  yy->__deadline= yy->__maxclock ? YY_BUDGET_CLOCK() + yy->__maxclock : 0;\n\
+#endif\n\
+#ifdef YY_MAX_DEPTH\n\
+  yy->__depth= 0;\n\
+#endif\n\
+  yyok= yystart(yy);\n\
+#if defined(YY_BUDGET) || defined(YY_MAX_DEPTH)\n\
+  if (yy->__abort) yyok= -yy->__abort;\n\
+#endif\n\
+  return yyok;\n\
+}\n\
+\n\
+YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)\n\
+{\n\
+  int yyok;\n\
+  if (!yyctx->__buflen)\n\
+    yyInit(yyctx);\n\
   yyctx->__thunkpos= 0;\n\
-  yyctx->__val= yyctx->__vals;\n\
-  yyok= yystart(yyctx);\n\
-  if (yyok) yyDone(yyctx);\n\
+#ifdef YY_AST\n\
+  yyctx->__astcount= 0;\n\
+  yyctx->__astparent= -1;\n\
+#endif\n\
+  yyok= yyMatch(yyctx, yystart);\n\
+  if (yyok > 0) yyDone(yyctx);\n\
   yyCommit(yyctx);\n\
   return yyok;\n\
 }\n\
@@ -851,8 +2273,186 @@ YY_PARSE(int) YYPARSE(YY_CTX_PARAM)\n\
   return YYPARSEFROM(YY_CTX_ARG_ yy_%s);\n\
 }\n\
 \n\
+YY_PARSE(int) YYPARSEMANYFROM(YY_CTX_PARAM_ yyrule yystart, int yymax)\n\
+{\n\
+  int yycount= 0, yybatch= 0;\n\
+  if (!yyctx->__buflen)\n\
+    yyInit(yyctx);\n\
+  yyctx->__thunkpos= 0;\n\
+#ifdef YY_AST\n\
+  yyctx->__astcount= 0;\n\
+  yyctx->__astparent= -1;\n\
+#endif\n\
+  while (yymax <= 0 || yycount < yymax)\n\
+    {\n\
+      int yypos= yyctx->__pos, yythunkpos= yyctx->__thunkpos;\n\
+      if (yyMatch(yyctx, yystart) <= 0)	/* an abort stays visible in __abort */\n\
+        {\n\
+          yyctx->__pos= yypos;\n\
+          yyctx->__thunkpos= yythunkpos;\n\
+          break;\n\
+        }\n\
+      ++yycount;\n\
+      if (yyctx->__pos == yypos)\n\
+        break;\n\
+      if (++yybatch == YY_BATCH_SIZE)\n\
+        {\n\
+          yyValReset(yyctx);\n\
+          yyDone(yyctx);\n\
+          yyCommit(yyctx);\n\
+          yybatch= 0;\n\
+        }\n\
+    }\n\
+  yyValReset(yyctx);\n\
+  yyDone(yyctx);\n\
+  yyCommit(yyctx);\n\
+  return yycount;\n\
+}\n\
+\n\
+YY_PARSE(int) YYPARSEMANY(YY_CTX_PARAM_ int yymax)\n\
+{\n\
+  return YYPARSEMANYFROM(YY_CTX_ARG_ yy_%s, yymax);\n\
+}\n\
+\n\
+#ifdef YY_FIND\n\
+YY_LOCAL(int) yyFindStart(yycontext *yy, const unsigned char *yyfirst, int yyc)\n\
+{\n\
+  const unsigned char *yyp= (const unsigned char *)yy->__buf + yy->__pos;\n\
+  const unsigned char *yye= (const unsigned char *)yy->__buf + yy->__limit;\n\
+  if (yyc >= 0)\n\
+    yyp= (const unsigned char *)memchr(yyp, yyc, yye - yyp);\n\
+  else\n\
+    {\n\
+      while (yyp < yye && !(yyfirst[*yyp >> 3] & (1 << (*yyp & 7)))) ++yyp;\n\
+      if (yyp == yye) yyp= 0;\n\
+    }\n\
+  return yyp ? (int)(yyp - (const unsigned char *)yy->__buf) : -1;\n\
+}\n\
+\n\
+YY_PARSE(int) YYFIND(YY_CTX_PARAM_ yyrule yystart, int yymax)\n\
+{\n\
+  const unsigned char *yyfirst= 0;\n\
+  int yycount= 0, yyc= -1, yyi;\n\
+  if (!yyctx->__buflen)\n\
+    yyInit(yyctx);\n\
+  for (yyi= 1;  yyi <= YYRULECOUNT;  ++yyi)\n\
+    if (yyfindrules[yyi] == yystart)\n\
+      yyfirst= (const unsigned char *)yyfirstsets[yyi];\n\
+  for (yyi= 0;  yyfirst && yyi < 256;  ++yyi)\n\
+    if (yyfirst[yyi >> 3] & (1 << (yyi & 7)))\n\
+      yyc= (yyc == -1) ? yyi : -2;\n\
+  yyctx->__thunkpos= 0;\n\
+  while (yymax <= 0 || yycount < yymax)\n\
+    {\n\
+      int yypos;\n\
+      if (yyctx->__pos >= yyctx->__limit)\n\
+        {\n\
+          yyctx->__base += yyctx->__pos;\n\
+          yyctx->__pos= yyctx->__limit= 0;\n\
+          if (!yyrefill(yyctx)) break;\n\
+        }\n\
+      if (yyfirst)\n\
+        {\n\
+          if ((yypos= yyFindStart(yyctx, yyfirst, yyc)) < 0)\n\
+            {\n\
+              yyctx->__pos= yyctx->__limit;\n\
+              continue;\n\
+            }\n\
+          yyctx->__pos= yypos;\n\
+        }\n\
+      yypos= yyctx->__pos;\n\
+      if (yyMatch(yyctx, yystart) > 0 && yyctx->__pos > yypos)\n\
+        {\n\
+          ++yycount;\n\
+          YY_FOUND(yyctx, yyctx->__base + yypos, yyctx->__base + yyctx->__pos);\n\
+          yyValReset(yyctx);\n\
+          yyDone(yyctx);\n\
+        }\n\
+      else\n\
+        {\n\
+          yyctx->__pos= yypos + 1;\n\
+          yyctx->__thunkpos= 0;\n\
+        }\n\
+    }\n\
+  return yycount;\n\
+}\n\
+#endif\n\
+\n\
+#ifdef YY_PIPELINE\n\
+YY_LOCAL(void *) yyPipelineWorker(void *yyarg)\n\
+{\n\
+  yypipeline *p= (yypipeline *)yyarg;\n\
+  yycontext *yy= p->__ctx;\n\
+  for (;;)\n\
+    {\n\
+      yybatch *b= yyPipelineGet(p, p->__full, &p->__fullhead, &p->__fulltail, &p->__fullcond, 1);\n\
+      int yyi;\n\
+      if (!b) break;	/* stopped with nothing left to run */\n\
+      if (b->__reset) yy->__val= yy->__vals;\n\
+      for (yyi= 0;  yyi < b->__count;  ++yyi)\n\
+        {\n\
+          yyentry *e= &b->__entries[yyi];\n\
+          e->action(yy, e->text < 0 ? b->__text : b->__text + e->text, e->leng);\n\
+        }\n\
+      yyPipelinePut(p, p->__free, &p->__freetail, &p->__freecond, b);\n\
+    }\n\
+  return 0;\n\
+}\n\
+\n\
+YY_PARSE(int) YYPIPELINESTART(yycontext *yyctx)\n\
+{\n\
+  yypipeline *p;\n\
+  if (yyctx->__pipeline) return 1;\n\
+  if (!yyctx->__buflen)\n\
+    yyInit(yyctx);\n\
+  p= (yypipeline *)YY_MALLOC(yyctx, sizeof(yypipeline));\n\
+  memset(p, 0, sizeof(yypipeline));\n\
+  p->__ctx= yyctx;\n\
+  pthread_mutex_init(&p->__lock, 0);\n\
+  pthread_cond_init(&p->__fullcond, 0);\n\
+  pthread_cond_init(&p->__freecond, 0);\n\
+  if (pthread_create(&p->__consumer, 0, yyPipelineWorker, p))\n\
+    {\n\
+      pthread_cond_destroy(&p->__freecond);\n\
+      pthread_cond_destroy(&p->__fullcond);\n\
+      pthread_mutex_destroy(&p->__lock);\n\
+      YY_FREE(yyctx, p);\n\
+      return 0;\n\
+    }\n\
+  yyctx->__pipeline= p;\n\
+  return 1;\n\
+}\n\
+\n\
+YY_PARSE(void) YYPIPELINEFINISH(yycontext *yyctx)\n\
+{\n\
+  yypipeline *p= yyctx->__pipeline;\n\
+  int yyi;\n\
+  if (!p) return;\n\
+  pthread_mutex_lock(&p->__lock);\n\
+  p->__stop= 1;\n\
+  pthread_cond_signal(&p->__fullcond);\n\
+  pthread_mutex_unlock(&p->__lock);\n\
+  pthread_join(p->__consumer, 0);\n\
+  pthread_cond_destroy(&p->__freecond);\n\
+  pthread_cond_destroy(&p->__fullcond);\n\
+  pthread_mutex_destroy(&p->__lock);\n\
+  if (p->__reset) yyctx->__val= yyctx->__vals;\n\
+  for (yyi= 0;  yyi < p->__count;  ++yyi)\n\
+    {\n\
+      YY_FREE(yyctx, p->__batches[yyi]->__entries);\n\
+      YY_FREE(yyctx, p->__batches[yyi]->__text);\n\
+      YY_FREE(yyctx, p->__batches[yyi]);\n\
+    }\n\
+  YY_FREE(yyctx, p);\n\
+  yyctx->__pipeline= 0;\n\
+}\n\
+#endif\n\
+\n\
 YY_PARSE(yycontext *) YYRELEASE(yycontext *yyctx)\n\
 {\n\
+#ifdef YY_PIPELINE\n\
+  YYPIPELINEFINISH(yyctx);\n\
+#endif\n\
   if (yyctx->__buflen)\n\
     {\n\
       yyctx->__buflen= 0;\n\
@@ -861,82 +2461,646 @@ YY_PARSE(yycontext *) YYRELEASE(yycontext *yyctx)\n\
       YY_FREE(yyctx, yyctx->__thunks);\n\
       YY_FREE(yyctx, yyctx->__vals);\n\
     }\n\
+#ifdef YY_VM\n\
+  if (yyctx->__frameslen)\n\
+    {\n\
+      yyctx->__frameslen= 0;\n\
+      YY_FREE(yyctx, yyctx->__frames);\n\
+    }\n\
+#endif\n\
+#ifdef YY_AST\n\
+  if (yyctx->__astlen)\n\
+    {\n\
+      yyctx->__astlen= yyctx->__astcount= 0;\n\
+      YY_FREE(yyctx, yyctx->__ast);\n\
+    }\n\
+#endif\n\
+#ifdef YY_ARENA\n\
+  yyArenaReset(yyctx, 0);\n\
+#endif\n\
+#ifdef YY_SAMPLER\n\
+  if (yysampled == yyctx) yyStopSampler(yyctx);\n\
+  YY_FREE(yyctx, yyctx->__samples);\n\
+  yyctx->__samples= 0;\n\
+  yyctx->__sampleslen= 0;\n\
+#endif\n\
+#ifdef YY_HEATMAP\n\
+  if (yyctx->__heatsize)\n\
+    {\n\
+      yyctx->__heatsize= yyctx->__heatlen= 0;\n\
+      YY_FREE(yyctx, yyctx->__heat);\n\
+      YY_FREE(yyctx, yyctx->__heattext);\n\
+    }\n\
+#endif\n\
   return yyctx;\n\
 }\n\
-#ifdef YY_RULES_PROFILE\n\
 \n\
-YY_PARSE(int) yyShowRulesProfile(yycontext *yy, FILE *fp)\n\
+#ifdef YY_AST\n\
+YY_PARSE(yynode *) YYAST(yycontext *yyctx, int *yycount)\n\
 {\n\
-  int itotal_def_count = 0, itotal_def_succ_count = 0, itotal_def_fail_count = 0;\n\
-  for(int i=1; i <= YYRULECOUNT; ++i) {\n\
-    itotal_def_succ_count += yy->__rules_succeed_count[i];\n\
-    itotal_def_fail_count += yy->__rules_fail_count[i];\n\
-  }\n\
-  itotal_def_count += itotal_def_succ_count + itotal_def_fail_count;\n\
-  double dtotal_count = itotal_def_count;\n\
-  fprintf(fp, \"Total calls %%d,  calls per input byte %%.2f\\n\\n\", itotal_def_count, (itotal_def_count/(yy->__inputpos*1.0)));\n\
-  fprintf(fp, \"%%4s  %%10s  %%5s  %%10s  %%10s  %%s\\n\", \"id\", \"total\", \"%\", \"success\", \"fail\", \"definition\");\n\
-  fprintf(fp, \"\\n%%4s  %%10.d  %%5s  %%10.d  %%10.d  Total counters\", \"\", itotal_def_count, \"\", itotal_def_succ_count, itotal_def_fail_count);\n\
-  fprintf(fp, \"\\n%%4s  %%12s  %%5s  %%8.2f  %%10.2f  %%%% success/fail\\n\\n\", \"\", \"\", \"\", (itotal_def_succ_count/dtotal_count)*100.0, (itotal_def_fail_count/dtotal_count)*100.0);\n\
-  for(int i=1; i <= YYRULECOUNT; ++i) {\n\
-    int def_count = yy->__rules_succeed_count[i] + yy->__rules_fail_count[i];\n\
-    fprintf(fp, \"%%4.d  %%10.d  %%5.2f  %%10.d  %%10.d  %%s\\n\", i, def_count, (def_count/dtotal_count)*100.0,\n\
-	    yy->__rules_succeed_count[i], yy->__rules_fail_count[i], yyrulenames[i]);\n\
-  }\n\
-  return 0;\n\
+  if (yycount) *yycount= yyctx->__astcount;\n\
+  return yyctx->__ast;\n\
 }\n\
 #endif\n\
 \n\
-YY_PARSE(void) yylinecol(const unsigned char *input, int offset, int *line_out, int *col_out)\n\
+#ifdef YY_HEATMAP\n\
+YY_PARSE(int *) YYHEATMAP(yycontext *yyctx, int *yylength)\n\
 {\n\
-  int i, line = 1;\n\
+  if (yylength) *yylength= yyctx->__heatlen;\n\
+  return yyctx->__heat;\n\
+}\n\
+#endif\n\
 \n\
-  for (i = 0; i <= offset; ++i) {\n\
-    if(input[i] == '\\n') {\n\
-      ++line;\n\
+YY_PARSE(yycontext *) YYRESET(yycontext *yyctx)\n\
+{\n\
+  if (yyctx->__buflen > YY_RESET_LIMIT)\n\
+    {\n\
+      yyctx->__buflen= YY_BUFFER_SIZE;\n\
+      yyctx->__buf= (char *)YY_REALLOC(yyctx, yyctx->__buf, yyctx->__buflen);\n\
     }\n\
-  }\n\
-  while (i > 0) {\n\
-    if(input[--i] == '\\n') {\n\
-      ++i;\n\
-      break;\n\
+  if (yyctx->__textlen > YY_RESET_LIMIT)\n\
+    {\n\
+      yyctx->__textlen= YY_BUFFER_SIZE;\n\
+      yyctx->__text= (char *)YY_REALLOC(yyctx, yyctx->__text, yyctx->__textlen);\n\
     }\n\
-  }\n\
-  *line_out = line;\n\
-  *col_out = 1 + offset - i;\n\
+  if (sizeof(yythunk) * yyctx->__thunkslen > YY_RESET_LIMIT)\n\
+    {\n\
+      yyctx->__thunkslen= YY_STACK_SIZE;\n\
+      yyctx->__thunks= (yythunk *)YY_REALLOC(yyctx, yyctx->__thunks, sizeof(yythunk) * yyctx->__thunkslen);\n\
+    }\n\
+  if (sizeof(YYSTYPE) * yyctx->__valslen > YY_RESET_LIMIT)\n\
+    {\n\
+      yyctx->__valslen= YY_STACK_SIZE;\n\
+      yyctx->__vals= (YYSTYPE *)YY_REALLOC(yyctx, yyctx->__vals, sizeof(YYSTYPE) * yyctx->__valslen);\n\
+    }\n\
+#ifdef YY_VM\n\
+  if (sizeof(yyframe) * yyctx->__frameslen > YY_RESET_LIMIT)\n\
+    {\n\
+      yyctx->__frameslen= YY_STACK_SIZE;\n\
+      yyctx->__frames= (yyframe *)YY_REALLOC(yyctx, yyctx->__frames, sizeof(yyframe) * yyctx->__frameslen);\n\
+    }\n\
+  yyctx->__framepos= 0;\n\
+#endif\n\
+#ifdef YY_AST\n\
+  if (sizeof(yynode) * yyctx->__astlen > YY_RESET_LIMIT)\n\
+    {\n\
+      yyctx->__astlen= YY_STACK_SIZE;\n\
+      yyctx->__ast= (yynode *)YY_REALLOC(yyctx, yyctx->__ast, sizeof(yynode) * yyctx->__astlen);\n\
+    }\n\
+  yyctx->__astcount= 0;\n\
+#endif\n\
+#if defined(YY_AST) || defined(YY_EVENTS) || defined(YY_FIND) || defined(YY_HEATMAP) || defined(YY_TRACE) || defined(YY_DEBUG) || defined(YY_PROBES)\n\
+  yyctx->__base= 0;\n\
+#endif\n\
+#ifdef YY_HEATMAP\n\
+  yyctx->__heatlen= 0;\n\
+#endif\n\
+#ifdef YY_RULE_STACK\n\
+  yyctx->__stackdepth= 0;\n\
+#endif\n\
+#ifdef YY_TRACE\n\
+  yyctx->__tracecount= 0;\n\
+  yyctx->__tracedepth= 0;\n\
+#endif\n\
+#ifdef YY_ARENA\n\
+  yyArenaReset(yyctx, YY_RESET_LIMIT);\n\
+#endif\n\
+#ifdef YY_DEBUG\n\
+  if (yyctx->__buflen) memset(yyctx->__buf, 0, yyctx->__buflen);\n\
+  yyctx->__calldepth= 0;\n\
+  yyctx->__debugactive= yyctx->__debugrules[0];\n\
+#endif\n\
+  yyctx->__begin= yyctx->__end= yyctx->__pos= yyctx->__limit= yyctx->__thunkpos= 0;\n\
+  yyctx->__inputpos= yyctx->__lineno= yyctx->__linenopos= 0;\n\
+  return yyctx;\n\
 }\n\
 \n\
+#ifdef YY_CTX_LOCAL\n\
+YY_PARSE(yycontext *) YYCREATE(void)\n\
+{\n\
+  return (yycontext *)calloc(1, sizeof(yycontext));\n\
+}\n\
 #endif\n\
-";
-
-void Rule_compile_c_header(void)
-{
-  fprintf(output, "/* A recursive-descent parser generated by peg %d.%d.%d */\n", PEG_MAJOR, PEG_MINOR, PEG_LEVEL);
-  fprintf(output, "\n");
-  fprintf(output, "%s", header);
-  fprintf(output, "#define YYRULECOUNT %d\n", ruleCount);
-}
-
-int consumesInput(Node *node)
-{
-  if (!node) return 0;
-
-  switch (node->type)
-    {
-    case Rule:
-      {
-	int result= 0;
-	if (RuleReached & node->rule.flags)
-	  fprintf(stderr, "possible infinite left recursion in rule '%s'\n", node->rule.name);
-	else
-	  {
-	    node->rule.flags |= RuleReached;
-	    result= consumesInput(node->rule.expression);
-	    node->rule.flags &= ~RuleReached;
-	  }
-	return result;
-      }
-      break;
+\n\
+#if defined(YY_POOL) && defined(YY_CTX_LOCAL)\n\
+YY_LOCAL(void) yyPoolMark(int *mark, int value)\n\
+{\n\
+  int old= __atomic_load_n(mark, __ATOMIC_RELAXED);\n\
+  while (value > old && !__atomic_compare_exchange_n(mark, &old, value, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))\n\
+    ;\n\
+}\n\
+\n\
+YY_LOCAL(int) yyPoolSize(int *mark, int initial, int size)\n\
+{\n\
+  int n= __atomic_load_n(mark, __ATOMIC_RELAXED);\n\
+  if ((long)n * size > YY_RESET_LIMIT) n= YY_RESET_LIMIT / size;\n\
+  return n > initial ? n : initial;\n\
+}\n\
+\n\
+YY_PARSE(yycontext *) YYACQUIRE(yypool *yyp)\n\
+{\n\
+  yycontext *yyctx;\n\
+  int i;\n\
+  for (i= 0;  i < YY_POOL_SIZE;  ++i)\n\
+    if (__atomic_load_n(&yyp->__contexts[i], __ATOMIC_RELAXED)\n\
+        && (yyctx= __atomic_exchange_n(&yyp->__contexts[i], 0, __ATOMIC_ACQUIRE)))\n\
+      return yyctx;\n\
+  if (!(yyctx= YYCREATE()))\n\
+    return 0;\n\
+  yyctx->__buflen= yyPoolSize(&yyp->__buflen, YY_BUFFER_SIZE, 1);\n\
+  yyctx->__buf= (char *)YY_MALLOC(yyctx, yyctx->__buflen);\n\
+#ifdef YY_DEBUG\n\
+  memset(yyctx->__buf, 0, yyctx->__buflen);\n\
+#endif\n\
+  yyctx->__textlen= yyPoolSize(&yyp->__textlen, YY_BUFFER_SIZE, 1);\n\
+  yyctx->__text= (char *)YY_MALLOC(yyctx, yyctx->__textlen);\n\
+  yyctx->__thunkslen= yyPoolSize(&yyp->__thunkslen, YY_STACK_SIZE, sizeof(yythunk));\n\
+  yyctx->__thunks= (yythunk *)YY_MALLOC(yyctx, sizeof(yythunk) * yyctx->__thunkslen);\n\
+  yyctx->__valslen= yyPoolSize(&yyp->__valslen, YY_STACK_SIZE, sizeof(YYSTYPE));\n\
+  yyctx->__vals= (YYSTYPE *)YY_MALLOC(yyctx, sizeof(YYSTYPE) * yyctx->__valslen);\n\
+  return yyctx;\n\
+}\n\
+\n\
+YY_PARSE(void) YYRECYCLE(yypool *yyp, yycontext *yyctx)\n\
+{\n\
+  int i;\n\
+  yyPoolMark(&yyp->__buflen, yyctx->__buflen);\n\
+  yyPoolMark(&yyp->__textlen, yyctx->__textlen);\n\
+  yyPoolMark(&yyp->__thunkslen, yyctx->__thunkslen);\n\
+  yyPoolMark(&yyp->__valslen, yyctx->__valslen);\n\
+  YYRESET(yyctx);\n\
+  for (i= 0;  i < YY_POOL_SIZE;  ++i)\n\
+    {\n\
+      yycontext *yyempty= 0;\n\
+      if (__atomic_compare_exchange_n(&yyp->__contexts[i], &yyempty, yyctx, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED))\n\
+        return;\n\
+    }\n\
+  free(YYRELEASE(yyctx));\n\
+}\n\
+\n\
+YY_PARSE(void) YYDRAIN(yypool *yyp)\n\
+{\n\
+  int i;\n\
+  for (i= 0;  i < YY_POOL_SIZE;  ++i)\n\
+    {\n\
+      yycontext *yyctx= __atomic_exchange_n(&yyp->__contexts[i], 0, __ATOMIC_ACQUIRE);\n\
+      if (yyctx) free(YYRELEASE(yyctx));\n\
+    }\n\
+}\n\
+#endif\n\
+\n\
+#ifdef YY_PARALLEL\n\
+typedef struct _yychunk {\n\
+  yycontext  __ctx;\n\
+  int        __begin;\n\
+  int        __end;\n\
+  int        __records;\n\
+} yychunk;\n\
+\n\
+typedef struct _yyparallel {\n\
+  yychunk   *__chunks;\n\
+  int        __count;\n\
+  int        __next;\n\
+  yyrule     __start;\n\
+} yyparallel;\n\
+\n\
+YY_LOCAL(void) yyChunkInit(yycontext *yyctx, yycontext *yy, const char *yyinput, int yylength)\n\
+{\n\
+  *yy= *yyctx;\n\
+  yy->__buflen= 0;\n\
+#ifdef YY_VM\n\
+  yy->__frames= 0;\n\
+  yy->__frameslen= yy->__framepos= 0;\n\
+#endif\n\
+#ifdef YY_PIPELINE\n\
+  yy->__pipeline= 0;\n\
+#endif\n\
+#ifdef YY_AST\n\
+  yy->__ast= 0;\n\
+  yy->__astlen= yy->__astcount= 0;\n\
+#endif\n\
+#ifdef YY_ARENA\n\
+  yy->__arena= yy->__arenacur= 0;\n\
+#endif\n\
+#ifdef YY_HEATMAP\n\
+  yy->__heat= 0;\n\
+  yy->__heattext= 0;\n\
+  yy->__heatlen= yy->__heatsize= 0;\n\
+#endif\n\
+#ifdef YY_RULE_STACK\n\
+  yy->__stackdepth= 0;\n\
+#endif\n\
+#ifdef YY_SAMPLER\n\
+  yy->__samples= 0;\n\
+  yy->__sampleslen= yy->__samplesdropped= 0;\n\
+#endif\n\
+#ifdef YY_TRACE\n\
+  yy->__tracecount= 0;\n\
+  yy->__tracedepth= 0;\n\
+#endif\n\
+  yyInit(yy);\n\
+  if (yylength >= yy->__buflen)\n\
+    {\n\
+      yy->__buflen= yylength + 1;\n\
+      yy->__buf= (char *)YY_REALLOC(yy, yy->__buf, yy->__buflen);\n\
+    }\n\
+  memcpy(yy->__buf, yyinput, yylength);\n\
+  yy->__buf[yylength]= '\\0';\n\
+  yy->__limit= yylength;\n\
+  yy->__resident= 1;\n\
+  yy->__inputpos= yy->__lineno= yy->__linenopos= 0;\n\
+}\n\
+\n\
+YY_LOCAL(int) yySyncPoint(yycontext *yyctx, const char *yyinput, int yyfrom, int yyto, yyrule yysync)\n\
+{\n\
+  yycontext yy;\n\
+  int yypos, yyresult= -1;\n\
+  yyChunkInit(yyctx, &yy, yyinput + yyfrom, yyto - yyfrom);\n\
+  for (yypos= 0;  yypos < yy.__limit;  ++yypos)\n\
+    {\n\
+      yy.__begin= yy.__end= yy.__pos= yypos;\n\
+      yy.__thunkpos= 0;\n\
+      yy.__val= yy.__vals;\n\
+      if (yysync(&yy) && yy.__pos > yypos)\n\
+        {\n\
+          yyresult= yyfrom + yy.__pos;\n\
+          break;\n\
+        }\n\
+    }\n\
+  YYRELEASE(&yy);\n\
+  return yyresult;\n\
+}\n\
+\n\
+YY_LOCAL(void *) yyChunkWorker(void *yyarg)\n\
+{\n\
+  yyparallel *yyp= (yyparallel *)yyarg;\n\
+  int yyi;\n\
+  while ((yyi= __atomic_fetch_add(&yyp->__next, 1, __ATOMIC_RELAXED)) < yyp->__count)\n\
+    {\n\
+      yychunk   *yyc= &yyp->__chunks[yyi];\n\
+      yycontext *yy= &yyc->__ctx;\n\
+      while (yy->__pos < yy->__limit)\n\
+        {\n\
+          int yypos= yy->__pos;\n\
+          if (yyMatch(yy, yyp->__start) <= 0 || yy->__pos == yypos) break;\n\
+          ++yyc->__records;\n\
+        }\n\
+      if (yy->__pos < yy->__limit) yyc->__records= -1;\n\
+    }\n\
+  return 0;\n\
+}\n\
+\n\
+YY_PARSE(int) YYPARSEPARALLEL(yycontext *yyctx, const char *yyinput, int yylength, yyrule yystart, yyrule yysync, int yythreads)\n\
+{\n\
+  yyparallel yyp;\n\
+  pthread_t *yytids;\n\
+  int yyi, yypos, yyrecords= 0;\n\
+  int yymax= (yythreads > 0 ? yythreads : 1) * YY_PARALLEL_CHUNKS;\n\
+  int yysize= yylength / yymax + 1;\n\
+  if (!yyctx->__buflen)\n\
+    yyInit(yyctx);\n\
+  yyp.__chunks= (yychunk *)YY_MALLOC(yyctx, sizeof(yychunk) * yymax);\n\
+  yyp.__count= yyp.__next= 0;\n\
+  yyp.__start= yystart;\n\
+  for (yypos= 0;  yypos < yylength;  )\n\
+    {\n\
+      int yyend= yylength;\n\
+      if (yyp.__count < yymax - 1 && yypos + yysize < yylength)\n\
+        {\n\
+          int yyto= yypos + 2 * yysize < yylength ? yypos + 2 * yysize : yylength;\n\
+          if ((yyend= yySyncPoint(yyctx, yyinput, yypos + yysize, yyto, yysync)) < 0 && yyto < yylength)\n\
+            yyend= yySyncPoint(yyctx, yyinput, yypos + yysize, yylength, yysync);\n\
+          if (yyend < 0)	/* no record boundary left: this chunk takes the rest */\n\
+            yyend= yylength;\n\
+        }\n\
+      yyp.__chunks[yyp.__count].__begin= yypos;\n\
+      yyp.__chunks[yyp.__count].__end= yyend;\n\
+      yyp.__chunks[yyp.__count].__records= 0;\n\
+      yyChunkInit(yyctx, &yyp.__chunks[yyp.__count].__ctx, yyinput + yypos, yyend - yypos);\n\
+      ++yyp.__count;\n\
+      yypos= yyend;\n\
+    }\n\
+  if (yythreads > yyp.__count) yythreads= yyp.__count;\n\
+  yytids= (pthread_t *)YY_MALLOC(yyctx, sizeof(pthread_t) * (yythreads > 0 ? yythreads : 1));\n\
+  for (yyi= 1;  yyi < yythreads;  ++yyi)\n\
+    if (pthread_create(&yytids[yyi], 0, yyChunkWorker, &yyp))\n\
+      break;\n\
+  yythreads= yyi;\n\
+  yyChunkWorker(&yyp);\n\
+  for (yyi= 1;  yyi < yythreads;  ++yyi)\n\
+    pthread_join(yytids[yyi], 0);\n\
+  YY_FREE(yyctx, yytids);\n\
+  for (yyi= 0;  yyi < yyp.__count && yyrecords >= 0;  ++yyi)\n\
+    yyrecords= yyp.__chunks[yyi].__records < 0 ? -1 : yyrecords + yyp.__chunks[yyi].__records;\n\
+  for (yyi= 0;  yyi < yyp.__count;  ++yyi)\n\
+    {\n\
+      yycontext *yy= &yyp.__chunks[yyi].__ctx;\n\
+      int yypos;\n\
+      yyctx->__val= yyctx->__vals;\n\
+      if (yyrecords >= 0)\n\
+        for (yypos= 0;  yypos < yy->__thunkpos;  ++yypos)\n\
+          {\n\
+            yythunk *yyt= &yy->__thunks[yypos];\n\
+            int yyleng= yyt->end ? yyText(yy, yyt->begin, yyt->end) : yyt->begin;\n\
+            yyt->action(yyctx, yy->__text, yyleng);\n\
+          }\n\
+      YYRELEASE(yy);\n\
+    }\n\
+  YY_FREE(yyctx, yyp.__chunks);\n\
+  return yyrecords;\n\
+}\n\
+#endif\n\
+#ifdef YY_RULES_PROFILE\n\
+\n\
+YY_PARSE(int) yyShowRulesProfile(yycontext *yy, FILE *fp)\n\
+{\n\
+  yycount itotal_def_count = 0, itotal_def_succ_count = 0, itotal_def_fail_count = 0;\n\
+  for(int i=1; i <= YYRULECOUNT; ++i) {\n\
+    itotal_def_succ_count += yy->__rules_succeed_count[i];\n\
+    itotal_def_fail_count += yy->__rules_fail_count[i];\n\
+  }\n\
+  itotal_def_count += itotal_def_succ_count + itotal_def_fail_count;\n\
+  double dtotal_count = itotal_def_count;\n\
+  fprintf(fp, \"Total calls %%llu,  calls per input byte %%.2f\\n\\n\", itotal_def_count,\n\
+	  yy->__rules_input ? itotal_def_count / (double)yy->__rules_input : 0.0);\n\
+  fprintf(fp, \"%%4s  %%10s  %%5s  %%10s  %%10s  %%s\\n\", \"id\", \"total\", \"%\", \"success\", \"fail\", \"definition\");\n\
+  fprintf(fp, \"\\n%%4s  %%10.llu  %%5s  %%10.llu  %%10.llu  Total counters\", \"\", itotal_def_count, \"\", itotal_def_succ_count, itotal_def_fail_count);\n\
+  fprintf(fp, \"\\n%%4s  %%12s  %%5s  %%8.2f  %%10.2f  %%%% success/fail\\n\\n\", \"\", \"\", \"\", (itotal_def_succ_count/dtotal_count)*100.0, (itotal_def_fail_count/dtotal_count)*100.0);\n\
+  for(int i=1; i <= YYRULECOUNT; ++i) {\n\
+    yycount def_count = yy->__rules_succeed_count[i] + yy->__rules_fail_count[i];\n\
+    fprintf(fp, \"%%4.d  %%10.llu  %%5.2f  %%10.llu  %%10.llu  %%s\\n\", i, def_count, (def_count/dtotal_count)*100.0,\n\
+	    yy->__rules_succeed_count[i], yy->__rules_fail_count[i], yyrulenames[i]);\n\
+  }\n\
+  yytime total_time = 0;\n\
+  int order[YYRULECOUNT+1], n = 0;\n\
+  for(int i=1; i <= YYRULECOUNT; ++i) {\n\
+    int j = n++;\n\
+    total_time += yy->__rules_self_time[i];\n\
+    while (j > 0 && yy->__rules_self_time[order[j-1]] < yy->__rules_self_time[i]) {\n\
+      order[j] = order[j-1];\n\
+      --j;\n\
+    }\n\
+    order[j] = i;\n\
+  }\n\
+  fprintf(fp, \"\\nTotal time %%llu \" YY_PROFILE_UNIT \"\\n\\n\", total_time);\n\
+  fprintf(fp, \"%%4s  %%14s  %%6s  %%14s  %%10s  %%s\\n\", \"id\", \"self\", \"%%\", \"inclusive\", \"calls\", \"definition\");\n\
+  for(int k=0; k < n; ++k) {\n\
+    int i = order[k];\n\
+    fprintf(fp, \"%%4d  %%14llu  %%6.2f  %%14llu  %%10llu  %%s\\n\", i, yy->__rules_self_time[i],\n\
+	    total_time ? yy->__rules_self_time[i] * 100.0 / total_time : 0.0, yy->__rules_total_time[i],\n\
+	    yy->__rules_succeed_count[i] + yy->__rules_fail_count[i], yyrulenames[i]);\n\
+  }\n\
+#ifndef YY_VM\n\
+  int alts[YYALTCOUNT+1], m = 0;\n\
+  for(int a=1; a <= YYALTCOUNT; ++a) {\n\
+    int j = m;\n\
+    if (!yy->__alt_tries[a]) continue;\n\
+    ++m;\n\
+    while (j > 0 && yy->__alt_waste[alts[j-1]] < yy->__alt_waste[a]) {\n\
+      alts[j] = alts[j-1];\n\
+      --j;\n\
+    }\n\
+    alts[j] = a;\n\
+  }\n\
+  fprintf(fp, \"\\n%%6s  %%10s  %%10s  %%6s  %%12s  %%s\\n\", \"line\", \"tries\", \"hits\", \"fail%%\", \"wasted\", \"alternative\");\n\
+  for(int k=0; k < m; ++k) {\n\
+    int a = alts[k];\n\
+    yycount tries = yy->__alt_tries[a];\n\
+    fprintf(fp, \"%%6d  %%10llu  %%10llu  %%6.2f  %%12llu  %%s/%%d\\n\", yyalternatives[a].line, tries, yy->__alt_hits[a],\n\
+	    (tries - yy->__alt_hits[a]) * 100.0 / tries, yy->__alt_waste[a], yyrulenames[yyalternatives[a].rule], yyalternatives[a].index);\n\
+  }\n\
+#endif\n\
+  return 0;\n\
+}\n\
+\n\
+/* Machine-readable profiles.  Every column is a plain count, so that\n\
+ * profiles of the same grammar from several processes can be added\n\
+ * together by pegprof(1).\n\
+ */\n\
+\n\
+YY_PARSE(int) yyShowRulesProfileCSV(yycontext *yy, FILE *fp)\n\
+{\n\
+  fprintf(fp, \"kind,name,id,line,index,succeed,fail,self,inclusive,tries,hits,wasted\\n\");\n\
+  fprintf(fp, \"input,%%s,0,0,0,%%llu,0,0,0,0,0,0\\n\", YY_PROFILE_UNIT, yy->__rules_input);\n\
+  for(int i=1; i <= YYRULECOUNT; ++i)\n\
+    fprintf(fp, \"rule,%%s,%%d,%%d,0,%%llu,%%llu,%%llu,%%llu,0,0,0\\n\", yyrulenames[i], i, yyrulelines[i],\n\
+	    yy->__rules_succeed_count[i], yy->__rules_fail_count[i], yy->__rules_self_time[i], yy->__rules_total_time[i]);\n\
+#ifndef YY_VM\n\
+  for(int a=1; a <= YYALTCOUNT; ++a)\n\
+    fprintf(fp, \"alternative,%%s,%%d,%%d,%%d,0,0,0,0,%%llu,%%llu,%%llu\\n\", yyrulenames[yyalternatives[a].rule], yyalternatives[a].rule,\n\
+	    yyalternatives[a].line, yyalternatives[a].index, yy->__alt_tries[a], yy->__alt_hits[a], yy->__alt_waste[a]);\n\
+#endif\n\
+  return 0;\n\
+}\n\
+\n\
+YY_PARSE(int) yyShowRulesProfileJSON(yycontext *yy, FILE *fp)\n\
+{\n\
+  fprintf(fp, \"{\\n  \\\"unit\\\": \\\"%%s\\\",\\n  \\\"input\\\": %%llu,\\n  \\\"rules\\\": [\", YY_PROFILE_UNIT, yy->__rules_input);\n\
+  for(int i=1; i <= YYRULECOUNT; ++i)\n\
+    fprintf(fp, \"%%s\\n    { \\\"name\\\": \\\"%%s\\\", \\\"id\\\": %%d, \\\"line\\\": %%d, \\\"succeed\\\": %%llu, \\\"fail\\\": %%llu, \\\"self\\\": %%llu, \\\"inclusive\\\": %%llu }\",\n\
+	    i > 1 ? \",\" : \"\", yyrulenames[i], i, yyrulelines[i],\n\
+	    yy->__rules_succeed_count[i], yy->__rules_fail_count[i], yy->__rules_self_time[i], yy->__rules_total_time[i]);\n\
+  fprintf(fp, \"\\n  ],\\n  \\\"alternatives\\\": [\");\n\
+#ifndef YY_VM\n\
+  for(int a=1; a <= YYALTCOUNT; ++a)\n\
+    fprintf(fp, \"%%s\\n    { \\\"name\\\": \\\"%%s\\\", \\\"id\\\": %%d, \\\"line\\\": %%d, \\\"index\\\": %%d, \\\"tries\\\": %%llu, \\\"hits\\\": %%llu, \\\"wasted\\\": %%llu }\",\n\
+	    a > 1 ? \",\" : \"\", yyrulenames[yyalternatives[a].rule], yyalternatives[a].rule, yyalternatives[a].line,\n\
+	    yyalternatives[a].index, yy->__alt_tries[a], yy->__alt_hits[a], yy->__alt_waste[a]);\n\
+#endif\n\
+  fprintf(fp, \"\\n  ]\\n}\\n\");\n\
+  return 0;\n\
+}\n\
+#endif\n\
+#ifdef YY_HEATMAP\n\
+\n\
+#ifndef YY_HEATMAP_WIDTH\n\
+#define YY_HEATMAP_WIDTH 64\n\
+#endif\n\
+\n\
+YY_PARSE(int) yyShowHeatMap(yycontext *yy, FILE *fp)\n\
+{\n\
+  static const char glyphs[]= \" .:-=+*#%%@\";\n\
+  long total= 0;\n\
+  int i, start, line= 1, bytes= 0, max= 1;\n\
+  for (i= 0;  i < yy->__heatlen;  ++i) {\n\
+    total += yy->__heat[i];\n\
+    if (yy->__heat[i]) ++bytes;\n\
+    if (yy->__heat[i] > max) max= yy->__heat[i];\n\
+  }\n\
+  fprintf(fp, \"Rescanned %%d of %%d bytes, %%ld times in total (%%.2f per byte)\\n\\n\", bytes, yy->__heatlen, total,\n\
+	  yy->__heatlen ? total / (yy->__heatlen * 1.0) : 0.0);\n\
+  fprintf(fp, \"%%6s  %%10s  %%6s  %%s\\n\", \"line\", \"rescanned\", \"max\", \"text\");\n\
+  for (start= 0;  start < yy->__heatlen;  start= i + 1, ++line) {\n\
+    long sum= 0;\n\
+    int end, peak= 0, k;\n\
+    for (i= start;  i < yy->__heatlen && '\\n' != yy->__heattext[i];  ++i) {\n\
+      sum += yy->__heat[i];\n\
+      if (yy->__heat[i] > peak) peak= yy->__heat[i];\n\
+    }\n\
+    if (!sum) continue;\n\
+    end= i - start > YY_HEATMAP_WIDTH ? start + YY_HEATMAP_WIDTH : i;\n\
+    fprintf(fp, \"%%6d  %%10ld  %%6d  \", line, sum, peak);\n\
+    for (k= start;  k < end;  ++k)\n\
+      fputc(isprint((unsigned char)yy->__heattext[k]) ? yy->__heattext[k] : ' ', fp);\n\
+    fprintf(fp, \"%%s\\n%%28s\", end < i ? \"...\" : \"\", \"\");\n\
+    while (end > start && !yy->__heat[end - 1]) --end;\n\
+    for (k= start;  k < end;  ++k)\n\
+      fputc(glyphs[(yy->__heat[k] * 9 + max - 1) / max], fp);\n\
+    fputc('\\n', fp);\n\
+  }\n\
+  return 0;\n\
+}\n\
+#endif\n\
+#ifdef YY_RULE_STACK\n\
+\n\
+YY_PARSE(int) yyShowRuleStack(yycontext *yy, FILE *fp)\n\
+{\n\
+  int i, depth= yy->__stackdepth < YY_RULE_STACK_SIZE ? yy->__stackdepth : YY_RULE_STACK_SIZE;\n\
+  for (i= 0;  i < depth;  ++i)\n\
+    fprintf(fp, \"%%s%%s\", i ? \";\" : \"\", yyrulenames[yy->__stack[i]]);\n\
+  fprintf(fp, \"\\n\");\n\
+  return yy->__stackdepth;\n\
+}\n\
+#endif\n\
+#ifdef YY_SAMPLER\n\
+\n\
+YY_PARSE(int) yyStartSampler(yycontext *yy, int usec)\n\
+{\n\
+  struct sigaction sa;\n\
+  struct itimerval it;\n\
+  yycontext *yyidle= 0;\n\
+  if (!yy->__samples && !(yy->__samples= (int *)YY_MALLOC(yy, sizeof(int) * YY_SAMPLER_SIZE)))\n\
+    return -1;\n\
+  if (!__atomic_compare_exchange_n(&yysampled, &yyidle, yy, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) && yyidle != yy)\n\
+    return -1;		/* the process timer is already sampling another context */\n\
+  memset(&sa, 0, sizeof(sa));\n\
+  sa.sa_handler= yySampleSignal;\n\
+  sa.sa_flags= SA_RESTART;\n\
+  sigemptyset(&sa.sa_mask);\n\
+  it.it_interval.tv_sec= usec / 1000000;\n\
+  it.it_interval.tv_usec= usec %% 1000000;\n\
+  it.it_value= it.it_interval;\n\
+  if (sigaction(SIGPROF, &sa, 0) || setitimer(ITIMER_PROF, &it, 0))\n\
+    {\n\
+      yysampled= 0;\n\
+      return -1;\n\
+    }\n\
+  return 0;\n\
+}\n\
+\n\
+YY_PARSE(void) yyStopSampler(yycontext *yy)\n\
+{\n\
+  struct itimerval it;\n\
+  if (yysampled != yy) return;\n\
+  memset(&it, 0, sizeof(it));\n\
+  setitimer(ITIMER_PROF, &it, 0);\n\
+  yysampled= 0;\n\
+}\n\
+\n\
+YY_LOCAL(int) yySampleCompare(const void *a, const void *b)\n\
+{\n\
+  const int *p= *(const int **)a, *q= *(const int **)b;\n\
+  int i, n= p[0] < q[0] ? p[0] : q[0];\n\
+  for (i= 1;  i <= n;  ++i)\n\
+    if (p[i] != q[i]) return p[i] - q[i];\n\
+  return p[0] - q[0];\n\
+}\n\
+\n\
+YY_PARSE(int) yyShowFoldedStacks(yycontext *yy, FILE *fp)\n\
+{\n\
+  int **samples, count= 0, i, j, k;\n\
+  for (i= 0;  i < yy->__sampleslen;  i += yy->__samples[i] + 1)\n\
+    ++count;\n\
+  samples= (int **)YY_MALLOC(yy, sizeof(int *) * (count + 1));\n\
+  for (i= j= 0;  i < yy->__sampleslen;  i += yy->__samples[i] + 1)\n\
+    samples[j++]= yy->__samples + i;\n\
+  qsort(samples, count, sizeof(int *), yySampleCompare);\n\
+  for (i= 0;  i < count;  i= j)\n\
+    {\n\
+      for (j= i + 1;  j < count && !yySampleCompare(&samples[i], &samples[j]);  ++j)\n\
+	;\n\
+      for (k= 1;  k <= samples[i][0];  ++k)\n\
+	fprintf(fp, \"%%s%%s\", k > 1 ? \";\" : \"\", yyrulenames[samples[i][k]]);\n\
+      fprintf(fp, \" %%d\\n\", j - i);\n\
+    }\n\
+  YY_FREE(yy, samples);\n\
+  return count;\n\
+}\n\
+#endif\n\
+#ifdef YY_TRACE\n\
+\n\
+YY_PARSE(int) yyDumpTrace(yycontext *yy, FILE *fp)\n\
+{\n\
+  unsigned long long n= yy->__tracecount < YY_TRACE_SIZE ? yy->__tracecount : YY_TRACE_SIZE, i;\n\
+  fprintf(fp, \"PEGTRACE %%d %%d %%llu %%llu\\n\", (int)sizeof(yytrace), YYRULECOUNT, yy->__tracecount, n);\n\
+  for (i= 1;  i <= YYRULECOUNT;  ++i)\n\
+    fprintf(fp, \"%%s\\n\", yyrulenames[i]);\n\
+  for (i= yy->__tracecount - n;  i < yy->__tracecount;  ++i)\n\
+    fwrite(&yy->__trace[i %% YY_TRACE_SIZE], sizeof(yytrace), 1, fp);\n\
+  return 0;\n\
+}\n\
+#endif\n\
+\n\
+YY_PARSE(void) yylinecol(const unsigned char *input, int offset, int *line_out, int *col_out)\n\
+{\n\
+  int i, line = 1;\n\
+\n\
+  for (i = 0; i <= offset; ++i) {\n\
+    if(input[i] == '\\n') {\n\
+      ++line;\n\
+    }\n\
+  }\n\
+  while (i > 0) {\n\
+    if(input[--i] == '\\n') {\n\
+      ++i;\n\
+      break;\n\
+    }\n\
+  }\n\
+  *line_out = line;\n\
+  *col_out = 1 + offset - i;\n\
+}\n\
+\n\
+#endif\n\
+";
+
+void Rule_compile_c_header(int reentrant)
+{
+  Node *n;
+
+  fprintf(output, "/* A recursive-descent parser generated by peg %d.%d.%d */\n", PEG_MAJOR, PEG_MINOR, PEG_LEVEL);
+  fprintf(output, "\n");
+  fprintf(output, "%s", header);
+  if (reentrant)
+    fprintf(output, "#ifndef YY_CTX_LOCAL\n#define YY_CTX_LOCAL 1\n#endif\n");
+  if (recognizer)
+    fprintf(output, "#define YY_RECOGNIZER 1\n");
+  fprintf(output, "#define YYRULECOUNT %d\n", ruleCount);
+  altCount= 0;
+  for (n= rules;  n;  n= n->rule.next)
+    numberCompiledAlternatives(n, n, 0);
+  fprintf(output, "#define YYALTCOUNT %d\n", altCount);
+}
+
+int consumesInput(Node *node)
+{
+  if (!node) return 0;
+
+  switch (node->type)
+    {
+    case Rule:
+      {
+	int result= 0;
+	if (RuleReached & node->rule.flags)
+	  fprintf(stderr, "possible infinite left recursion in rule '%s'\n", node->rule.name);
+	else
+	  {
+	    node->rule.flags |= RuleReached;
+	    result= consumesInput(node->rule.expression);
+	    node->rule.flags &= ~RuleReached;
+	  }
+	return result;
+      }
+      break;
 
     case Dot:		return 1;
     case Name:		return consumesInput(node->name.rule);
@@ -980,21 +3144,13 @@ int consumesInput(Node *node)
 }
 
 
-void Rule_compile_c(Node *node, int nolines)
+static void Rule_compile_c_names(Node *node, char *condition)
 {
   Node *n;
   struct Rule **rules_list;
   int idx;
 
-  for (n= rules;  n;  n= n->rule.next)
-    consumesInput(n);
-
-  fprintf(output, "%s", preamble);
-  for (n= node;  n;  n= n->rule.next)
-    fprintf(output, "YY_RULE(int) yy_%s(yycontext *yy); /* %d */\n", n->rule.name, n->rule.id);
-  fprintf(output, "\n");
-
-  fprintf(output, "#ifdef YY_RULES_PROFILE\nstatic const char *yyrulenames[YYRULECOUNT+1] = {\nNULL,\n");
+  fprintf(output, "#if %s\nstatic const char *const yyrulenames[YYRULECOUNT+1] = {\nNULL,\n", condition);
   rules_list = calloc(ruleCount, sizeof(struct Rule*));
   idx = -1;
   for (n= node;  n;  n= n->rule.next)
@@ -1004,7 +3160,67 @@ void Rule_compile_c(Node *node, int nolines)
     fprintf(output, "\"%s\", /* %d */\n", r->name, r->id);
   }
   fprintf(output, "\n};\n#endif\n");
+  fprintf(output, "#ifdef YY_RULES_PROFILE\nstatic const int yyrulelines[YYRULECOUNT+1] = {\n0,\n");
+  for (idx= 0;  idx < ruleCount;  ++idx)
+    fprintf(output, "%d, /* %s */\n", rules_list[ruleCount - 1 - idx]->line, rules_list[ruleCount - 1 - idx]->name);
+  fprintf(output, "};\n#endif\n");
   free(rules_list);
+}
+
+static void Rule_compile_c_first(Node *node)
+{
+  unsigned char (*first)[32]= calloc(ruleCount + 1, 32);
+  char		 *nullable= calloc(ruleCount + 1, 1);
+  Node		**byId= calloc(ruleCount + 1, sizeof(Node *));
+  Node		 *n;
+  int		  id, i;
+
+  Rule_compute_first(node, first, nullable);
+  for (n= node;  n;  n= n->rule.next)
+    byId[n->rule.id]= n;
+  fprintf(output, "#ifdef YY_FIND\nstatic int (*const yyfindrules[YYRULECOUNT+1])(yycontext *)= {\n  0,\n");
+  for (id= 1;  id <= ruleCount;  ++id)
+    if (byId[id]->rule.expression)
+      fprintf(output, "  yy_%s,\n", byId[id]->rule.name);
+    else
+      fprintf(output, "  0,\n");
+  fprintf(output, "};\nstatic const char *const yyfirstsets[YYRULECOUNT+1]= {\n  0,\n");
+  for (id= 1;  id <= ruleCount;  ++id)
+    if (nullable[id] || !byId[id]->rule.expression)
+      fprintf(output, "  0,\n");
+    else
+      {
+	fprintf(output, "  \"");
+	for (i= 0;  i < 32;  ++i)
+	  fprintf(output, "\\%03o", first[id][i]);
+	fprintf(output, "\",\n");
+      }
+  fprintf(output, "};\n#endif\n");
+  free(byId);
+  free(nullable);
+  free(first);
+}
+
+static void Rule_compile_c1(Node *node, int nolines, char *namesCondition)
+{
+  Node *n;
+
+  for (n= rules;  n;  n= n->rule.next)
+    consumesInput(n);
+  recognizerText= 0;
+  for (n= rules;  n;  n= n->rule.next)
+    recognizerText |= needsText(n->rule.expression);
+
+  fprintf(output, "%s", preamble);
+  for (n= node;  n;  n= n->rule.next)
+    fprintf(output, "YY_RULE(int) yy_%s(yycontext *yy); /* %d */\n", n->rule.name, n->rule.id);
+  fprintf(output, "\n");
+
+  Rule_compile_c_names(node, namesCondition);
+  Rule_compile_c_first(node);
+
+  if (recognizer)
+    return;
 
   for (n= actions;  n;  n= n->action.list)
     {
@@ -1019,6 +3235,715 @@ void Rule_compile_c(Node *node, int nolines)
       undefineVariables(n->action.rule->rule.variables);
       fprintf(output, "}\n");
     }
+}
+
+static void Rule_compile_c_alternatives(void)
+{
+  int i;
+  fprintf(output, "\n\n#ifdef YY_RULES_PROFILE\nstatic const struct { int rule, line, index; } yyalternatives[YYALTCOUNT+1]= {\n  { 0, 0, 0 },\n");
+  for (i= 1;  i <= altCount;  ++i)
+    fprintf(output, "  { %d, %d, %d },\n", altRules[i]->rule.id, altRules[i]->rule.line, altIndices[i]);
+  fprintf(output, "};\n#endif\n");
+}
+
+void Rule_compile_c(Node *node, int nolines)
+{
+  Rule_compile_c1(node, nolines, "defined(YY_RULES_PROFILE) || defined(YY_DEBUG) || defined(YY_AST) || defined(YY_EVENTS) || defined(YY_TRACE) || defined(YY_PROBES) || defined(YY_RULE_STACK)");
   Rule_compile_c2(node);
-  fprintf(output, footer, start->rule.name);
+  Rule_compile_c_alternatives();
+  free(altRules);
+  free(altIndices);
+  altRules= 0;
+  altIndices= 0;
+  fprintf(output, footer, start->rule.name, start->rule.name);
+}
+
+
+/* Bytecode backend.  Rules are compiled into a single table of integer
+ * instructions executed by a small threaded-code interpreter that keeps
+ * its call and backtrack frames in a heap-allocated stack.  Actions are
+ * still compiled as C functions; predicates, inline actions and error
+ * actions become C functions called from the interpreter.
+ */
+
+static char *vmOpNames[]= { "Call", "Ret", "Choice", "ErrChoice", "Commit", "PartialCommit", "BackCommit", "FailTwice", "Fail",
+			    "Dot", "Char", "CharI", "String", "StringI", "Class", "ClassI", "Begin", "End", "Predicate", "Inline",
+			    "Action", "Set", "Push", "Pop" };
+
+enum { SlotOp, SlotInt, SlotLabel, SlotRule };
+
+typedef struct { int kind, value; } VmSlot;
+
+static VmSlot  *vmCode= 0;		static int vmCodeLen= 0,	vmCodeMax= 0;
+static int     *vmLabels= 0;		static int vmLabelCount= 0,	vmLabelMax= 0;
+static char   **vmStrings= 0;		static int vmStringCount= 0,	vmStringMax= 0;
+static char   **vmClasses= 0;		static int vmClassCount= 0,	vmClassMax= 0;
+static Node   **vmFragments= 0;		static int vmFragmentCount= 0,	vmFragmentMax= 0;
+static int     *vmRuleAddr= 0;
+
+static int vmOpArity[]= { 2, 0, 1, 1, 1, 1, 1, 0, 0,
+			  0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1,
+			  1, 1, 1, 1 };
+
+#define vmGrow(V, N, M)								\
+  while ((N) >= (M))								\
+    {										\
+      (M)= (M) ? (M) * 2 : 64;							\
+      (V)= realloc((V), sizeof(*(V)) * (M));					\
+    }
+
+static void vmSlot(int kind, int value)
+{
+  vmGrow(vmCode, vmCodeLen, vmCodeMax);
+  vmCode[vmCodeLen].kind= kind;
+  vmCode[vmCodeLen].value= value;
+  ++vmCodeLen;
+}
+
+static void vmOp(VmOp op)		{ vmSlot(SlotOp, op); }
+static void vmInt(int value)		{ vmSlot(SlotInt, value); }
+static void vmJump(VmOp op, int l)	{ vmOp(op);  vmSlot(SlotLabel, l); }
+
+static int vmLabel(void)
+{
+  vmGrow(vmLabels, vmLabelCount, vmLabelMax);
+  vmLabels[vmLabelCount]= -1;
+  return vmLabelCount++;
+}
+
+static void vmPlace(int l)		{ vmLabels[l]= vmCodeLen; }
+
+static int vmIntern(char ***table, int *count, int *max, char *text)
+{
+  int i;
+  for (i= 0;  i < *count;  ++i)
+    if (!strcmp((*table)[i], text))
+      return i;
+  vmGrow(*table, *count, *max);
+  (*table)[*count]= strdup(text);
+  return (*count)++;
+}
+
+static int vmFragment(Node *node)
+{
+  vmGrow(vmFragments, vmFragmentCount, vmFragmentMax);
+  vmFragments[vmFragmentCount]= node;
+  return vmFragmentCount++;
+}
+
+static int vmAction(Node *node)
+{
+  Node *n;
+  int   index= 0;
+  for (n= actions;  n != node;  n= n->action.list)
+    ++index;
+  return index;
+}
+
+static void Node_compile_vm(Node *node)
+{
+  assert(node);
+  switch (node->type)
+    {
+    case Rule:
+      fprintf(stderr, "\ninternal error #1 (%s)\n", node->rule.name);
+      exit(1);
+      break;
+
+    case Dot:
+      vmOp(opDot);
+      break;
+
+    case Name:
+      vmOp(opCall);
+      vmSlot(SlotRule, node->name.rule->rule.id);
+      vmInt(node->name.rule->rule.id);
+      if (node->name.variable && !recognizer)
+	{
+	  vmOp(opSet);
+	  vmInt(node->name.variable->variable.offset);
+	}
+      break;
+
+    case Character:
+    case String:
+      {
+	int len= strlen(node->string.value);
+	int caseInsensitive= node->string.caseInsensitive;
+	if (1 == len || (2 == len && '\\' == node->string.value[0]))
+	  {
+	    unsigned char *value= (unsigned char *)node->string.value;
+	    vmOp(caseInsensitive ? opCharI : opChar);
+	    vmInt(cnext(&value));
+	  }
+	else
+	  {
+	    vmOp(caseInsensitive ? opStringI : opString);
+	    vmInt(vmIntern(&vmStrings, &vmStringCount, &vmStringMax, node->string.value));
+	  }
+      }
+      break;
+
+    case Class:
+      vmOp(node->cclass.caseInsensitive ? opClassI : opClass);
+      vmInt(vmIntern(&vmClasses, &vmClassCount, &vmClassMax, makeCharClass(node->cclass.value, node->cclass.caseInsensitive)));
+      break;
+
+    case Action:
+      if (recognizer) break;
+      vmOp(opAction);
+      vmInt(vmAction(node));
+      break;
+
+    case Inline:
+      if (recognizer) break;
+      vmOp(opInline);
+      vmInt(vmFragment(node));
+      break;
+
+    case Predicate:
+      if (recognizer && isCapture(node) && !recognizerText)
+	break;
+      if (!strcmp(node->predicate.text, "YY_BEGIN"))
+	vmOp(opBegin);
+      else if (!strcmp(node->predicate.text, "YY_END"))
+	vmOp(opEnd);
+      else
+	{
+	  vmOp(opPredicate);
+	  vmInt(vmFragment(node));
+	}
+      break;
+
+    case Error:
+      {
+	int eko= vmLabel(), eok= vmLabel();
+	if (recognizer)
+	  {
+	    Node_compile_vm(node->error.element);
+	    break;
+	  }
+	vmJump(opErrChoice, eko);
+	Node_compile_vm(node->error.element);
+	vmJump(opCommit, eok);
+	vmPlace(eko);
+	vmOp(opInline);
+	vmInt(vmFragment(node));
+	vmOp(opFail);
+	vmPlace(eok);
+      }
+      break;
+
+    case Alternate:
+      {
+	int ok= vmLabel();
+	for (node= node->alternate.first;  node;  node= node->alternate.next)
+	  if (node->alternate.next)
+	    {
+	      int next= vmLabel();
+	      vmJump(opChoice, next);
+	      Node_compile_vm(node);
+	      vmJump(opCommit, ok);
+	      vmPlace(next);
+	    }
+	  else
+	    Node_compile_vm(node);
+	vmPlace(ok);
+      }
+      break;
+
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	Node_compile_vm(node);
+      break;
+
+    case PeekFor:
+      {
+	int ko= vmLabel(), ok= vmLabel();
+	vmJump(opChoice, ko);
+	Node_compile_vm(node->peekFor.element);
+	vmJump(opBackCommit, ok);
+	vmPlace(ko);
+	vmOp(opFail);
+	vmPlace(ok);
+      }
+      break;
+
+    case PeekNot:
+      {
+	int ok= vmLabel();
+	vmJump(opChoice, ok);
+	Node_compile_vm(node->peekNot.element);
+	vmOp(opFailTwice);
+	vmPlace(ok);
+      }
+      break;
+
+    case Query:
+      {
+	int qok= vmLabel();
+	vmJump(opChoice, qok);
+	Node_compile_vm(node->query.element);
+	vmJump(opCommit, qok);
+	vmPlace(qok);
+      }
+      break;
+
+    case Plus:
+      Node_compile_vm(node->plus.element);
+      /* fall through */
+
+    case Star:
+      {
+	int again= vmLabel(), out= vmLabel();
+	vmJump(opChoice, out);
+	vmPlace(again);
+	Node_compile_vm(node->star.element);
+	vmJump(opPartialCommit, again);
+	vmPlace(out);
+      }
+      break;
+
+    default:
+      fprintf(stderr, "\nNode_compile_vm: illegal node type %d\n", node->type);
+      exit(1);
+    }
+}
+
+static void Rule_compile_vm2(Node *node)
+{
+  for (;  node;  node= node->rule.next)
+    {
+      vmRuleAddr[node->rule.id]= vmCodeLen;
+      if (!node->rule.expression)
+	{
+	  vmOp(opFail);
+	  continue;
+	}
+      if (node->rule.variables && !recognizer)
+	{
+	  vmOp(opPush);
+	  vmInt(countVariables(node->rule.variables));
+	}
+      Node_compile_vm(node->rule.expression);
+      if (node->rule.variables && !recognizer)
+	{
+	  vmOp(opPop);
+	  vmInt(countVariables(node->rule.variables));
+	}
+      vmOp(opRet);
+    }
+}
+
+static char *vmInterpreter= "\
+#if defined(__GNUC__) && !defined(YY_VM_SWITCH)\n\
+# define YY_VM_THREADED 1\n\
+#endif\n\
+\n\
+YY_LOCAL(yyframe *) yyPushFrame(yycontext *yy, int pc, int rule)\n\
+{\n\
+  yyframe *f;\n\
+  while (yy->__framepos >= yy->__frameslen)\n\
+    {\n\
+      yy->__frameslen= yy->__frameslen ? yy->__frameslen * 2 : YY_STACK_SIZE;\n\
+      yy->__frames= (yyframe *)YY_REALLOC(yy, yy->__frames, sizeof(yyframe) * yy->__frameslen);\n\
+    }\n\
+  f= &yy->__frames[yy->__framepos++];\n\
+  f->pc= pc;\n\
+  f->pos= yy->__pos;\n\
+  f->thunkpos= yy->__thunkpos;\n\
+  f->rule= rule;\n\
+  return f;\n\
+}\n\
+\n\
+YY_LOCAL(int) yyRuleThunkpos(yycontext *yy)\n\
+{\n\
+  int i;\n\
+  for (i= yy->__framepos - 1;  yy->__frames[i].rule <= 0;  --i);\n\
+  return yy->__frames[i].thunkpos;\n\
+}\n\
+\n\
+YY_LOCAL(int) yyexec(yycontext *yy, int pc, int rule)\n\
+{\n\
+#ifdef YY_VM_THREADED\n\
+  static const void *const yylabels[]= {\n\
+# define YY_OPLABEL(N)	&&yyL##N,\n\
+    YY_OPCODES(YY_OPLABEL)\n\
+# undef YY_OPLABEL\n\
+  };\n\
+# define YYNEXT		goto *yylabels[yyprogram[pc++]]\n\
+#else\n\
+# define YYNEXT		continue\n\
+#endif\n\
+#define YYOP(N)		case yyOp##N: yyL##N\n\
+  int      base= yy->__framepos;\n\
+  int      ret= -1;\n\
+  yyframe *f;\n\
+  goto yyenter;\n\
+\n\
+ yyfail:\n\
+  while (yy->__framepos > base)\n\
+    {\n\
+      f= &yy->__frames[--yy->__framepos];\n\
+      if (f->rule < 0)\n\
+	{\n\
+	  pc= f->pc;\n\
+	  goto yynext;\n\
+	}\n\
+#ifdef YY_HEATMAP\n\
+      yyHeat(yy, f->pos);\n\
+#endif\n\
+      yy->__pos= f->pos;\n\
+      yy->__thunkpos= f->thunkpos;\n\
+      if (!f->rule)\n\
+	{\n\
+	  pc= f->pc;\n\
+	  goto yynext;\n\
+	}\n\
+#ifdef YY_RULES_PROFILE\n\
+      ++yy->__rules_fail_count[f->rule];\n\
+      yyProfileLeave(yy, f->rule, &f->profile);\n\
+#endif\n\
+#ifdef YY_TRACE\n\
+      yyTrace(yy, YY_TRACE_FAIL, f->rule);\n\
+#endif\n\
+#ifdef YY_PROBES\n\
+      YY_PROBE_RULE_EXIT(yy, f->rule, yy->__base + yy->__pos, 0);\n\
+#endif\n\
+#ifdef YY_RULE_STACK\n\
+      yyStackPop(yy);\n\
+#endif\n\
+#ifdef YY_MAX_DEPTH\n\
+      --yy->__depth;\n\
+#endif\n\
+      yyprintf((stderr, \"%*.s  fail %s @%d:%d %s\\n\", yy->__calldepth, __yyindentspaces, yyrulenames[f->rule], yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));\n\
+      yyDebugLeave(yy, f->rule);\n\
+    }\n\
+  return 0;\n\
+\n\
+ yynext:\n\
+  for (;;)\n\
+    switch (yyprogram[pc++])\n\
+      {\n\
+      YYOP(Call):\n\
+	rule= yyprogram[pc + 1];\n\
+	ret= pc + 2;\n\
+	pc= yyprogram[pc];\n\
+      yyenter:\n\
+#ifdef YY_BUDGET\n\
+	if (yyBudget(yy)) goto yyfail;\n\
+#endif\n\
+#ifdef YY_MAX_DEPTH\n\
+	if (yyDepth(yy)) goto yyfail;\n\
+#endif\n\
+	yyPushFrame(yy, ret, rule);\n\
+#ifdef YY_RULES_PROFILE\n\
+	yyProfileEnter(yy, rule, &yy->__frames[yy->__framepos - 1].profile);\n\
+#endif\n\
+#ifdef YY_TRACE\n\
+	yyTrace(yy, YY_TRACE_ENTER, rule);\n\
+#endif\n\
+#ifdef YY_PROBES\n\
+	YY_PROBE_RULE_ENTER(yy, rule, yy->__base + yy->__pos);\n\
+#endif\n\
+#ifdef YY_RULE_STACK\n\
+	yyStackPush(yy, rule);\n\
+#endif\n\
+#ifdef YY_EVENTS\n\
+	yyDo(yy, yyEventEnter, yy->__pos, rule);\n\
+#endif\n\
+#ifdef YY_AST\n\
+	yyDo(yy, yyAstEnter, yy->__pos, rule);\n\
+#endif\n\
+	yyDebugEnter(yy, rule);\n\
+	yyprintf((stderr, \"%*.s%s\\n\", yy->__calldepth - 1, __yyindentspaces, yyrulenames[rule]));\n\
+	YYNEXT;\n\
+\n\
+      YYOP(Ret):\n\
+	f= &yy->__frames[--yy->__framepos];\n\
+#ifdef YY_AST\n\
+	yyDo(yy, yyAstLeave, yy->__pos, 0);\n\
+#endif\n\
+#ifdef YY_EVENTS\n\
+	yyDo(yy, yyEventLeave, yy->__pos, f->thunkpos);\n\
+#endif\n\
+#ifdef YY_TRACE\n\
+	yyTrace(yy, YY_TRACE_OK, f->rule);\n\
+#endif\n\
+#ifdef YY_PROBES\n\
+	YY_PROBE_RULE_EXIT(yy, f->rule, yy->__base + yy->__pos, 1);\n\
+#endif\n\
+#ifdef YY_RULE_STACK\n\
+	yyStackPop(yy);\n\
+#endif\n\
+#ifdef YY_RULES_PROFILE\n\
+	++yy->__rules_succeed_count[f->rule];\n\
+	yyProfileLeave(yy, f->rule, &f->profile);\n\
+#endif\n\
+#ifdef YY_MAX_DEPTH\n\
+	--yy->__depth;\n\
+#endif\n\
+	yyprintf((stderr, \"%*.s  ok   %s @%d:%d %s\\n\", yy->__calldepth, __yyindentspaces, yyrulenames[f->rule], yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+f->pos));\n\
+	yyDebugLeave(yy, f->rule);\n\
+	if ((pc= f->pc) < 0) return 1;\n\
+	YYNEXT;\n\
+\n\
+      YYOP(Choice):\n\
+	yyPushFrame(yy, yyprogram[pc], 0);\n\
+	++pc;\n\
+	YYNEXT;\n\
+\n\
+      YYOP(ErrChoice):\n\
+	yyPushFrame(yy, yyprogram[pc], -1);\n\
+	++pc;\n\
+	YYNEXT;\n\
+\n\
+      YYOP(Commit):\n\
+	--yy->__framepos;\n\
+	pc= yyprogram[pc];\n\
+	YYNEXT;\n\
+\n\
+      YYOP(PartialCommit):\n\
+	f= &yy->__frames[yy->__framepos - 1];\n\
+	f->pos= yy->__pos;\n\
+	f->thunkpos= yy->__thunkpos;\n\
+	pc= yyprogram[pc];\n\
+	YYNEXT;\n\
+\n\
+      YYOP(BackCommit):\n\
+	f= &yy->__frames[--yy->__framepos];\n\
+#ifdef YY_HEATMAP\n\
+	yyHeat(yy, f->pos);\n\
+#endif\n\
+	yy->__pos= f->pos;\n\
+	yy->__thunkpos= f->thunkpos;\n\
+	pc= yyprogram[pc];\n\
+	YYNEXT;\n\
+\n\
+      YYOP(FailTwice):\n\
+	--yy->__framepos;\n\
+	goto yyfail;\n\
+\n\
+      YYOP(Fail):\n\
+	goto yyfail;\n\
+\n\
+      YYOP(Dot):\n\
+	if (!yymatchDot(yy)) goto yyfail;\n\
+	YYNEXT;\n\
+\n\
+      YYOP(Char):\n\
+	if (!yymatchChar(yy, yyprogram[pc++])) goto yyfail;\n\
+	YYNEXT;\n\
+\n\
+      YYOP(CharI):\n\
+	if (!yymatchCharCaseInsensitive(yy, yyprogram[pc++])) goto yyfail;\n\
+	YYNEXT;\n\
+\n\
+      YYOP(String):\n\
+	if (!yymatchString(yy, yystrings[yyprogram[pc++]])) goto yyfail;\n\
+	YYNEXT;\n\
+\n\
+      YYOP(StringI):\n\
+	if (!yymatchStringCaseInsensitive(yy, yystrings[yyprogram[pc++]])) goto yyfail;\n\
+	YYNEXT;\n\
+\n\
+      YYOP(Class):\n\
+	if (!yymatchClass(yy, (unsigned char *)yyclasses[yyprogram[pc++]])) goto yyfail;\n\
+	YYNEXT;\n\
+\n\
+      YYOP(ClassI):\n\
+	if (!yymatchClassCaseInsensitive(yy, (unsigned char *)yyclasses[yyprogram[pc++]])) goto yyfail;\n\
+	YYNEXT;\n\
+\n\
+      YYOP(Begin):\n\
+	if (!(YY_BEGIN)) goto yyfail;\n\
+	YYNEXT;\n\
+\n\
+      YYOP(End):\n\
+	if (!(YY_END)) goto yyfail;\n\
+	YYNEXT;\n\
+\n\
+      YYOP(Predicate):\n\
+	if (!yycode[yyprogram[pc++]](yy, yyRuleThunkpos(yy))) goto yyfail;\n\
+	YYNEXT;\n\
+\n\
+      YYOP(Inline):\n\
+	yycode[yyprogram[pc++]](yy, yyRuleThunkpos(yy));\n\
+	YYNEXT;\n\
+\n\
+      YYOP(Action):\n\
+	yyDo(yy, yyactions[yyprogram[pc++]], yy->__begin, yy->__end);\n\
+	YYNEXT;\n\
+\n\
+      YYOP(Set):\n\
+	yyDo(yy, yySet, yyprogram[pc++], 0);\n\
+	YYNEXT;\n\
+\n\
+      YYOP(Push):\n\
+	yyDo(yy, yyPush, yyprogram[pc++], 0);\n\
+	YYNEXT;\n\
+\n\
+      YYOP(Pop):\n\
+	yyDo(yy, yyPop, yyprogram[pc++], 0);\n\
+	YYNEXT;\n\
+      }\n\
+#undef YYOP\n\
+#undef YYNEXT\n\
+}\n\
+\n\
+";
+
+static void vmPrintString(char *value)
+{
+  int i, len= strlen(value);
+  fputc('"', output);
+  for (i= 0;  i < len;  ++i)
+    {
+      if (value[i] == '"' && (!i || value[i-1] != '\\')) fputc('\\', output);
+      fputc(value[i], output);
+    }
+  fputc('"', output);
+}
+
+static void vmPrintFragment(Node *node, int index)
+{
+  fprintf(output, "YY_ACTION(int) yycode%d(yycontext *yy, int yythunkpos0)\n{\n", index);
+  fprintf(output, "  yyText(yy, yy->__begin, yy->__end);\n");
+  fprintf(output, "#define yytext yy->__text\n");
+  fprintf(output, "#define yyleng yy->__textlen\n");
+  switch (node->type)
+    {
+    case Predicate:	fprintf(output, "  return !!(%s);\n", node->predicate.text);		break;
+    case Inline:	fprintf(output, "  %s;\n  return 1;\n", node->inLine.text);		break;
+    case Error:		fprintf(output, "  {\n  %s;\n  }\n  return 1;\n", node->error.text);	break;
+    default:		assert(!"illegal fragment");
+    }
+  fprintf(output, "#undef yytext\n");
+  fprintf(output, "#undef yyleng\n");
+  fprintf(output, "}\n");
+}
+
+Program *Rule_compile_program(Node *node)
+{
+  Program *program= calloc(1, sizeof(Program));
+  int      pc;
+
+  vmCodeLen= vmLabelCount= vmFragmentCount= 0;
+  vmRuleAddr= calloc(ruleCount + 1, sizeof(int));
+  Rule_compile_vm2(node);
+
+  program->code= malloc(sizeof(int) * vmCodeLen);
+  for (pc= 0;  pc < vmCodeLen;  ++pc)
+    {
+      VmSlot *slot= &vmCode[pc];
+      switch (slot->kind)
+	{
+	case SlotLabel:	program->code[pc]= vmLabels[slot->value];	break;
+	case SlotRule:	program->code[pc]= vmRuleAddr[slot->value];	break;
+	default:	program->code[pc]= slot->value;			break;
+	}
+    }
+  program->length= vmCodeLen;
+  program->entries= vmRuleAddr;
+  program->strings= vmStrings;		program->stringCount= vmStringCount;
+  program->classes= vmClasses;		program->classCount= vmClassCount;
+  program->fragments= vmFragments;	program->fragmentCount= vmFragmentCount;
+
+  vmRuleAddr= 0;
+  vmStrings= 0;		vmStringCount= vmStringMax= 0;
+  vmClasses= 0;		vmClassCount= vmClassMax= 0;
+  vmFragments= 0;	vmFragmentCount= vmFragmentMax= 0;
+  return program;
+}
+
+void Program_free(Program *program)
+{
+  int i;
+  for (i= 0;  i < program->stringCount;  ++i) free(program->strings[i]);
+  for (i= 0;  i < program->classCount;   ++i) free(program->classes[i]);
+  free(program->strings);
+  free(program->classes);
+  free(program->fragments);
+  free(program->entries);
+  free(program->code);
+  free(program);
+}
+
+void Rule_compile_vm(Node *node, int nolines)
+{
+  Program *program;
+  Node    *n;
+  int      i, pc, column;
+
+  fprintf(output, "#define YY_VM 1\n");
+  Rule_compile_c1(node, nolines, "defined(YY_RULES_PROFILE) || defined(YY_DEBUG) || defined(YY_AST) || defined(YY_EVENTS) || defined(YY_TRACE) || defined(YY_PROBES) || defined(YY_RULE_STACK)");
+
+  for (n= node;  n;  n= n->rule.next)
+    if (!n->rule.expression)
+      fprintf(stderr, "rule '%s' used but not defined\n", n->rule.name);
+    else if ((!(RuleUsed & n->rule.flags)) && (n != start))
+      fprintf(stderr, "rule '%s' defined but not used\n", n->rule.name);
+
+  program= Rule_compile_program(node);
+
+  for (i= 0;  i < program->fragmentCount;  ++i)
+    vmPrintFragment(program->fragments[i], i);
+
+  fprintf(output, "\n#define YY_OPCODES(_)");
+  for (i= 0;  i < opCount;  ++i)
+    fprintf(output, "%s_(%s)", (i % 8) ? " " : "\t\\\n  ", vmOpNames[i]);
+  fprintf(output, "\n\nenum {\n#define YY_OPENUM(N)\tyyOp##N,\n  YY_OPCODES(YY_OPENUM)\n#undef YY_OPENUM\n};\n");
+
+  fprintf(output, "\nstatic const yyaction yyactions[]= {");
+  for (n= recognizer ? 0 : actions;  n;  n= n->action.list)
+    fprintf(output, "\n  yy%s,", n->action.name);
+  fprintf(output, "\n  0\n};\n");
+
+  fprintf(output, "\nstatic int (*const yycode[])(yycontext *, int)= {");
+  for (i= 0;  i < program->fragmentCount;  ++i)
+    fprintf(output, "\n  yycode%d,", i);
+  fprintf(output, "\n  0\n};\n");
+
+  fprintf(output, "\nstatic const char *const yystrings[]= {");
+  for (i= 0;  i < program->stringCount;  ++i)
+    {
+      fprintf(output, "\n  ");
+      vmPrintString(program->strings[i]);
+      fprintf(output, ",");
+    }
+  fprintf(output, "\n  0\n};\n");
+
+  fprintf(output, "\nstatic const char *const yyclasses[]= {");
+  for (i= 0;  i < program->classCount;  ++i)
+    fprintf(output, "\n  \"%s\",", program->classes[i]);
+  fprintf(output, "\n  0\n};\n");
+
+  fprintf(output, "\nstatic const int yyprogram[]= {");
+  for (pc= 0, column= 0;  pc < program->length;  )
+    {
+      int op= program->code[pc++];
+      for (n= node;  n;  n= n->rule.next)
+	if (program->entries[n->rule.id] == pc - 1)
+	  {
+	    fprintf(output, "\n/* %d %s */\n", pc - 1, n->rule.name);
+	    column= 0;
+	  }
+      if (column > 64)
+	{
+	  fprintf(output, "\n");
+	  column= 0;
+	}
+      column += fprintf(output, " yyOp%s,", vmOpNames[op]);
+      for (i= 0;  i < vmOpArity[op];  ++i)
+	column += fprintf(output, " %d,", program->code[pc++]);
+    }
+  fprintf(output, "\n};\n\n");
+
+  fprintf(output, "%s", vmInterpreter);
+
+  for (n= node;  n;  n= n->rule.next)
+    fprintf(output, "YY_UNUSED YY_RULE(int) yy_%s(yycontext *yy) { return yyexec(yy, %d, %d); }\n", n->rule.name, program->entries[n->rule.id], n->rule.id);
+
+  Program_free(program);
+  fprintf(output, footer, start->rule.name, start->rule.name);
 }
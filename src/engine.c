@@ -0,0 +1,448 @@
+/* Copyright (c) 2007 by Ian Piumarta
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the 'Software'),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, provided that the above copyright notice(s) and this
+ * permission notice appear in all copies of the Software.  Acknowledgement
+ * of the use of this Software in supporting documentation would be
+ * appreciated but is not required.
+ *
+ * THE SOFTWARE IS PROVIDED 'AS IS'.  USE ENTIRELY AT YOUR OWN RISK.
+ */
+
+#include "tree.h"
+#include "engine.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <setjmp.h>
+#include <assert.h>
+
+static const char *source= 0;
+static int	   sourcePos= 0;
+static int	   lineNumber= 0;
+static int	   inputPos= 0;
+static int	   lineNumberPos= 0;
+static int	   actionLine= 0;
+static int	   headerLine= 0;
+static Trailer	  *trailer= 0;
+static Header	  *headers= 0;
+static struct _yycontext *context= 0;
+static jmp_buf	   syntaxError;
+static char	   errorMessage[256];
+
+static void yyerror(char *message);
+
+#define YY_CTX_LOCAL
+
+#define YY_INPUT(yy, buf, result, max)			\
+{							\
+  int c= (unsigned char)source[sourcePos];		\
+  result= c ? (*(buf)= c, ++sourcePos, ++inputPos, 1) : 0; \
+}
+
+/* the engine uses only part of the front end's runtime */
+#ifdef __GNUC__
+# define YY_LOCAL(T)	__attribute__((unused)) static T
+#else
+# define YY_LOCAL(T)	static T
+#endif
+#define YY_RULE(T)	static T
+#define YY_PARSE(T)	static T
+
+#include "peg.peg-c"
+
+static void yyerror(char *message)
+{
+  int line, col;
+  yylinecol((unsigned char *)context->__buf, context->__begin, &line, &col);
+  snprintf(errorMessage, sizeof(errorMessage), "%d:%d %s", line, col, message);
+  longjmp(syntaxError, 1);
+}
+
+struct peg_grammar
+{
+  int		 *code;
+  int		  length;
+  int		  ruleCount;
+  int		  start;
+  int		 *entries;		/* indexed by rule id */
+  char		**ruleNames;		/* indexed by rule id */
+  unsigned char	(*first)[32];		/* indexed by rule id */
+  char		 *nullable;		/* indexed by rule id */
+  unsigned char	(*classes)[32];
+  char		**strings;
+  int		 *stringLengths;
+  char		**captures;		/* indexed by action */
+};
+
+static int  getBit(unsigned char bits[32], int c)	{ return bits[c >> 3] & (1 << (c & 7)); }
+
+static void decodeClass(char *escaped, unsigned char bits[32])
+{
+  int i;
+  for (i= 0;  i < 32;  ++i, escaped += 4)
+    bits[i]= ((escaped[1] - '0') << 6) + ((escaped[2] - '0') << 3) + (escaped[3] - '0');
+}
+
+static char *captureName(char *text)
+{
+  char *end, *name;
+  while (isspace((unsigned char)*text)) ++text;
+  for (end= text + strlen(text);  end > text && (isspace((unsigned char)end[-1]) || ';' == end[-1]);  --end);
+  name= (char *)malloc(end - text + 1);
+  memcpy(name, text, end - text);
+  name[end - text]= '\0';
+  return name;
+}
+
+static int checkGrammar(char *error, int errorlen)
+{
+  Program *program;
+  Node	  *n;
+  int	   ok= 1;
+  if (!rules)
+    {
+      snprintf(error, errorlen, "grammar has no rules");
+      return 0;
+    }
+  for (n= rules;  n;  n= n->rule.next)
+    if (!n->rule.expression)
+      {
+	snprintf(error, errorlen, "rule '%s' used but not defined", n->rule.name);
+	return 0;
+      }
+  program= Rule_compile_program(rules);
+  if (program->fragmentCount)
+    {
+      NodeType type= program->fragments[0]->type;
+      snprintf(error, errorlen, "%s cannot be used in a runtime grammar",
+	       Predicate == type ? "semantic predicate" : (Inline == type ? "inline action" : "error action"));
+      ok= 0;
+    }
+  Program_free(program);
+  return ok;
+}
+
+peg_grammar *peg_load(const char *text, char *error, int errorlen)
+{
+  static char  ignored[256];
+  peg_grammar *g;
+  Program     *program;
+  yycontext    ctx;
+  Node	      *n;
+  int	       i;
+
+  if (!error)
+    {
+      error= ignored;
+      errorlen= sizeof(ignored);
+    }
+
+  freeRules();
+  source= text;
+  sourcePos= inputPos= lineNumberPos= 0;
+  lineNumber= 1;
+  memset(&ctx, 0, sizeof(ctx));
+  context= &ctx;
+
+  if (setjmp(syntaxError))
+    {
+      snprintf(error, errorlen, "%s", errorMessage);
+      yyrelease(&ctx);
+      freeRules();
+      return 0;
+    }
+  if (!yyparse(&ctx))
+    yyerror("syntax error");
+  yyrelease(&ctx);
+
+  while (headers)
+    {
+      Header *next= headers->next;
+      free(headers->text);
+      free(headers);
+      headers= next;
+    }
+  free(trailer);
+  trailer= 0;
+
+  if (!checkGrammar(error, errorlen))
+    {
+      freeRules();
+      return 0;
+    }
+
+  g= calloc(1, sizeof(peg_grammar));
+  g->ruleCount= ruleCount;
+  g->start= start->rule.id;
+  g->ruleNames= calloc(ruleCount + 1, sizeof(char *));
+  g->first= calloc(ruleCount + 1, 32);
+  g->nullable= calloc(ruleCount + 1, 1);
+  for (n= rules;  n;  n= n->rule.next)
+    g->ruleNames[n->rule.id]= strdup(n->rule.name);
+  Rule_compute_first(rules, g->first, g->nullable);
+
+  program= Rule_compile_program(rules);
+  g->code= program->code;			program->code= 0;
+  g->length= program->length;
+  g->entries= program->entries;			program->entries= 0;
+  g->classes= calloc(program->classCount + 1, 32);
+  for (i= 0;  i < program->classCount;  ++i)
+    decodeClass(program->classes[i], g->classes[i]);
+  g->strings= calloc(program->stringCount + 1, sizeof(char *));
+  g->stringLengths= calloc(program->stringCount + 1, sizeof(int));
+  for (i= 0;  i < program->stringCount;  ++i)
+    {
+      unsigned char *value= (unsigned char *)program->strings[i];
+      char	    *string= malloc(strlen((char *)value) + 1);
+      int	     len= 0;
+      while (*value)
+	string[len++]= cnext(&value);
+      string[len]= '\0';
+      g->strings[i]= string;
+      g->stringLengths[i]= len;
+    }
+  Program_free(program);
+
+  for (i= 0, n= actions;  n;  n= n->action.list)
+    ++i;
+  g->captures= calloc(i + 1, sizeof(char *));
+  for (i= 0, n= actions;  n;  n= n->action.list)
+    g->captures[i++]= captureName(n->action.text);
+
+  freeRules();
+  return g;
+}
+
+void peg_free(peg_grammar *g)
+{
+  int i;
+  for (i= 0;  g->captures[i];  ++i) free(g->captures[i]);
+  for (i= 0;  g->strings[i];  ++i) free(g->strings[i]);
+  for (i= 1;  i <= g->ruleCount;  ++i) free(g->ruleNames[i]);
+  free(g->captures);
+  free(g->strings);
+  free(g->stringLengths);
+  free(g->classes);
+  free(g->ruleNames);
+  free(g->first);
+  free(g->nullable);
+  free(g->entries);
+  free(g->code);
+  free(g);
+}
+
+typedef struct { int pc, pos, thunkpos, rule; } Frame;
+typedef struct { int action, begin, end; } Thunk;
+
+#define grow(V, N, M, S)							\
+  if ((N) >= (M))								\
+    {										\
+      (M) *= 2;									\
+      (V)= ((V) == (S)) ? memcpy(malloc(sizeof(*(V)) * (M)), (S), sizeof(S))	\
+		        : realloc((V), sizeof(*(V)) * (M));			\
+    }
+
+int peg_match(peg_grammar *g, const char *rule, const char *text, int length, peg_capture capture, void *data)
+{
+  const unsigned char *input= (const unsigned char *)text;
+  Frame  frameStack[64], *frames= frameStack, *f;
+  Thunk  thunkStack[64], *thunks= thunkStack;
+  int	 frameslen= 64, framepos= 0, thunkslen= 64, thunkpos= 0;
+  int	 pos= 0, begin= 0, end= 0, pc, id= g->start, result= -1;
+  int   *code= g->code;
+
+  if (rule)
+    {
+      for (id= 1;  id <= g->ruleCount && strcmp(rule, g->ruleNames[id]);  ++id);
+      if (id > g->ruleCount) return -1;
+    }
+  pc= -1;
+  goto call;
+
+ fail:
+  while (framepos > 0)
+    {
+      f= &frames[--framepos];
+      if (f->rule < 0)
+	{
+	  pc= f->pc;
+	  goto next;
+	}
+      pos= f->pos;
+      thunkpos= f->thunkpos;
+      if (!f->rule)
+	{
+	  pc= f->pc;
+	  goto next;
+	}
+    }
+  goto done;
+
+ next:
+  for (;;)
+    switch (code[pc++])
+      {
+      case opCall:
+	id= code[pc + 1];
+	pc += 2;
+      call:
+	if (!g->nullable[id] && (pos >= length || !getBit(g->first[id], input[pos])))
+	  goto fail;
+	grow(frames, framepos, frameslen, frameStack);
+	f= &frames[framepos++];
+	f->pc= pc;
+	f->pos= pos;
+	f->thunkpos= thunkpos;
+	f->rule= id;
+	pc= g->entries[id];
+	break;
+
+      case opRet:
+	if ((pc= frames[--framepos].pc) < 0)
+	  {
+	    result= pos;
+	    goto done;
+	  }
+	break;
+
+      case opChoice:
+      case opErrChoice:
+	grow(frames, framepos, frameslen, frameStack);
+	f= &frames[framepos++];
+	f->pc= code[pc++];
+	f->pos= pos;
+	f->thunkpos= thunkpos;
+	f->rule= (opChoice == code[pc - 2]) ? 0 : -1;
+	break;
+
+      case opCommit:
+	--framepos;
+	pc= code[pc];
+	break;
+
+      case opPartialCommit:
+	frames[framepos - 1].pos= pos;
+	frames[framepos - 1].thunkpos= thunkpos;
+	pc= code[pc];
+	break;
+
+      case opBackCommit:
+	f= &frames[--framepos];
+	pos= f->pos;
+	thunkpos= f->thunkpos;
+	pc= code[pc];
+	break;
+
+      case opFailTwice:
+	--framepos;
+	goto fail;
+
+      case opFail:
+	goto fail;
+
+      case opDot:
+	if (pos >= length) goto fail;
+	++pos;
+	break;
+
+      case opChar:
+	if (pos >= length || input[pos] != code[pc]) goto fail;
+	++pos;
+	++pc;
+	break;
+
+      case opCharI:
+	if (pos >= length || tolower(input[pos]) != tolower(code[pc])) goto fail;
+	++pos;
+	++pc;
+	break;
+
+      case opString:
+	{
+	  int n= g->stringLengths[code[pc]];
+	  if (length - pos < n || memcmp(input + pos, g->strings[code[pc]], n)) goto fail;
+	  pos += n;
+	  ++pc;
+	  break;
+	}
+
+      case opStringI:
+	{
+	  const char *s= g->strings[code[pc]];
+	  int	      n= g->stringLengths[code[pc]], i;
+	  if (length - pos < n) goto fail;
+	  for (i= 0;  i < n;  ++i)
+	    if (tolower(input[pos + i]) != tolower((unsigned char)s[i])) goto fail;
+	  pos += n;
+	  ++pc;
+	  break;
+	}
+
+      case opClass:
+	if (pos >= length || !getBit(g->classes[code[pc]], input[pos])) goto fail;
+	++pos;
+	++pc;
+	break;
+
+      case opClassI:
+	if (pos >= length || !getBit(g->classes[code[pc]], tolower(input[pos]))) goto fail;
+	++pos;
+	++pc;
+	break;
+
+      case opBegin:
+	begin= pos;
+	break;
+
+      case opEnd:
+	end= pos;
+	break;
+
+      case opAction:
+	grow(thunks, thunkpos, thunkslen, thunkStack);
+	thunks[thunkpos].action= code[pc++];
+	thunks[thunkpos].begin= begin;
+	thunks[thunkpos].end= end;
+	++thunkpos;
+	break;
+
+      case opSet:
+      case opPush:
+      case opPop:
+	++pc;
+	break;
+
+      default:
+	assert(!"illegal instruction");
+	goto done;
+      }
+
+ done:
+  if (result >= 0 && capture)
+    {
+      char *buf= 0;
+      int   buflen= 0, i;
+      for (i= 0;  i < thunkpos;  ++i)
+	{
+	  Thunk *t= &thunks[i];
+	  int	 n= t->end > t->begin ? t->end - t->begin : 0;
+	  if (n >= buflen)
+	    buf= realloc(buf, buflen= n + 64);
+	  memcpy(buf, text + t->begin, n);
+	  buf[n]= '\0';
+	  capture(data, g->captures[t->action], buf, n, t->begin);
+	}
+      free(buf);
+    }
+  if (frames != frameStack) free(frames);
+  if (thunks != thunkStack) free(thunks);
+  return result;
+}
@@ -0,0 +1,68 @@
+/* Copyright (c) 2007 by Ian Piumarta
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the 'Software'),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, provided that the above copyright notice(s) and this
+ * permission notice appear in all copies of the Software.  Acknowledgement
+ * of the use of this Software in supporting documentation would be
+ * appreciated but is not required.
+ *
+ * THE SOFTWARE IS PROVIDED 'AS IS'.  USE ENTIRELY AT YOUR OWN RISK.
+ */
+
+/* Runtime grammar engine.  A grammar written in peg syntax is read at
+ * run time and compiled into the same bytecode used by 'peg -b', then
+ * matched against in-memory input without generating or compiling C.
+ *
+ * Actions cannot contain C code.  The text between the braces of an
+ * action is instead used as the name of a capture, and each action that
+ * would have been performed for a successful match is reported to the
+ * client's callback, in order, together with the text delimited by '<'
+ * and '>' (yytext).  For example
+ *
+ *	Number	<- < [0-9]+ >	{ number }
+ *
+ * reports a capture called "number" for every sequence of digits.
+ * Semantic predicates ('&{ }'), inline actions ('@{ }') and error
+ * actions ('~{ }') are rejected when the grammar is loaded.
+ *
+ * peg_load() uses the global state of the peg front end and must not be
+ * called concurrently from several threads.  A loaded grammar is
+ * read-only and peg_match() may be called on it from any number of
+ * threads at once.
+ */
+
+#ifndef PEG_ENGINE_H
+#define PEG_ENGINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct peg_grammar peg_grammar;
+
+typedef void (*peg_capture)(void *data, const char *name, const char *text, int length, int offset);
+
+/* Read and compile the grammar in 'source'.  Returns 0 and writes a
+ * message into 'error' (if non-null) if the grammar cannot be loaded.
+ */
+extern peg_grammar *peg_load(const char *source, char *error, int errorlen);
+
+/* Match 'input' starting from 'rule' (or the start rule if 'rule' is
+ * null).  Returns the number of bytes matched, or -1 if the input does
+ * not match.  Captures are reported to 'capture' only if the match
+ * succeeds.
+ */
+extern int peg_match(peg_grammar *grammar, const char *rule, const char *input, int length, peg_capture capture, void *data);
+
+extern void peg_free(peg_grammar *grammar);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PEG_ENGINE_H */
@@ -5,7 +5,8 @@
 #include <string.h>
 #include <ctype.h>
 #define YYRULECOUNT 42
-#line 20 "leg.leg"
+#define YYALTCOUNT 55
+#line 20 "src/leg.leg"
 
 # include "tree.h"
 # include "version.h"
@@ -25,6 +26,8 @@
   int   pegjsFlag= 0;
   int   nakedFlag= 0;
   int   nolinesFlag= 0;
+  int   bytecodeFlag= 0;
+  int   reentrantFlag= 0;
 
   static int	 lineNumber= 0;
   static int     inputPos= 0;
@@ -33,6 +36,8 @@
   static int	 actionLine= 0;
   static char	*fileName= 0;
   static char	*outfileName= 0;
+  static char	*profileName= 0;
+  static char	*annotateName= 0;
   static Trailer *trailer= 0;
   static Header	*headers= 0;
 
@@ -65,6 +70,20 @@
 #ifndef YY_RULE
 #define YY_RULE(T)	static T
 #endif
+#ifndef YY_UNUSED
+#ifdef __GNUC__
+#define YY_UNUSED	__attribute__((unused))
+#else
+#define YY_UNUSED
+#endif
+#endif
+#ifndef YY_UNLIKELY
+#ifdef __GNUC__
+#define YY_UNLIKELY(X)	__builtin_expect(!!(X), 0)
+#else
+#define YY_UNLIKELY(X)	(X)
+#endif
+#endif
 #ifndef YY_PARSE
 #define YY_PARSE(T)	T
 #endif
@@ -74,19 +93,121 @@
 #ifndef YYPARSEFROM
 #define YYPARSEFROM	yyparsefrom
 #endif
+#ifndef YYFIND
+#define YYFIND		yyfind
+#endif
+#ifndef YYPARSEMANY
+#define YYPARSEMANY	yyparse_many
+#endif
+#ifndef YYPARSEMANYFROM
+#define YYPARSEMANYFROM	yyparse_many_from
+#endif
 #ifndef YYRELEASE
 #define YYRELEASE	yyrelease
 #endif
+#ifndef YYCREATE
+#define YYCREATE	yycreate
+#endif
+#ifndef YYRESET
+#define YYRESET		yyreset
+#endif
+#ifndef YYACQUIRE
+#define YYACQUIRE	yyacquire
+#endif
+#ifndef YYRECYCLE
+#define YYRECYCLE	yyrecycle
+#endif
+#ifndef YYDRAIN
+#define YYDRAIN		yydrain
+#endif
+#ifndef YYPARSEPARALLEL
+#define YYPARSEPARALLEL	yyparse_parallel
+#endif
+#ifndef YYAST
+#define YYAST		yyast
+#endif
+#ifndef YYHEATMAP
+#define YYHEATMAP	yyheatmap
+#endif
+#ifndef YYPIPELINESTART
+#define YYPIPELINESTART	yypipeline_start
+#endif
+#ifndef YYPIPELINEFINISH
+#define YYPIPELINEFINISH	yypipeline_finish
+#endif
+#ifdef YY_EVENTS
+#ifndef YY_RULE_ENTER
+#define YY_RULE_ENTER(yy, rule, begin)
+#endif
+#ifndef YY_RULE_EXIT
+#define YY_RULE_EXIT(yy, rule, begin, end)
+#endif
+#endif
+#ifdef YY_PROBES
+#if !defined(YY_PROBE_RULE_ENTER) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#endif
+#endif
+#ifndef YY_PROBE_PROVIDER
+#define YY_PROBE_PROVIDER	peg
+#endif
+#ifdef DTRACE_PROBE4
+#ifndef YY_PROBE_RULE_ENTER
+#define YY_PROBE_RULE_ENTER(yy, rule, pos)		DTRACE_PROBE3(YY_PROBE_PROVIDER, rule__enter, rule, pos, yyrulenames[rule])
+#endif
+#ifndef YY_PROBE_RULE_EXIT
+#define YY_PROBE_RULE_EXIT(yy, rule, pos, ok)		DTRACE_PROBE4(YY_PROBE_PROVIDER, rule__exit, rule, pos, ok, yyrulenames[rule])
+#endif
+#ifndef YY_PROBE_REFILL
+#define YY_PROBE_REFILL(yy, pos, length)		DTRACE_PROBE2(YY_PROBE_PROVIDER, refill, pos, length)
+#endif
+#ifndef YY_PROBE_COMMIT
+#define YY_PROBE_COMMIT(yy, pos, kept)		DTRACE_PROBE2(YY_PROBE_PROVIDER, commit, pos, kept)
+#endif
+#ifndef YY_PROBE_ACTION
+#define YY_PROBE_ACTION(yy, action, begin, end)	DTRACE_PROBE3(YY_PROBE_PROVIDER, action, action, begin, end)
+#endif
+#endif
+#ifndef YY_PROBE_RULE_ENTER
+#define YY_PROBE_RULE_ENTER(yy, rule, pos)
+#endif
+#ifndef YY_PROBE_RULE_EXIT
+#define YY_PROBE_RULE_EXIT(yy, rule, pos, ok)
+#endif
+#ifndef YY_PROBE_REFILL
+#define YY_PROBE_REFILL(yy, pos, length)
+#endif
+#ifndef YY_PROBE_COMMIT
+#define YY_PROBE_COMMIT(yy, pos, kept)
+#endif
+#ifndef YY_PROBE_ACTION
+#define YY_PROBE_ACTION(yy, action, begin, end)
+#endif
+#endif
+#if defined(YY_FIND) && !defined(YY_FOUND)
+#define YY_FOUND(yy, begin, end)
+#endif
 #ifndef YY_BEGIN
 #define YY_BEGIN	( yy->__begin= yy->__pos, 1)
 #endif
 #ifndef YY_END
+#ifdef YY_AST
+#define YY_END		( yy->__end= yy->__pos, yyDo(yy, yyAstCapture, yy->__begin, yy->__end), 1)
+#else
 #define YY_END		( yy->__end= yy->__pos, 1)
 #endif
+#endif
 #ifdef YY_DEBUG
-# define yyprintf(args)	fprintf args
+# define yyDebugging(yy)	((yy)->__debugactive && (yy)->__base + (yy)->__pos >= (yy)->__debugfrom && (!(yy)->__debugto || (yy)->__base + (yy)->__pos < (yy)->__debugto))
+# define yyprintf(args)	do { if (yyDebugging(yy)) fprintf args; } while (0)
+# define yyDebugEnter(yy, rule)	(++(yy)->__calldepth, (yy)->__debugactive += (yy)->__debugrules[rule])
+# define yyDebugLeave(yy, rule)	(--(yy)->__calldepth, (yy)->__debugactive -= (yy)->__debugrules[rule])
+static const char __yyindentspaces[]= "                                              ";
 #else
 # define yyprintf(args)
+# define yyDebugEnter(yy, rule)
+# define yyDebugLeave(yy, rule)
 #endif
 #ifndef YYSTYPE
 #define YYSTYPE	int
@@ -99,11 +220,216 @@
 #define YY_BUFFER_SIZE 1024
 #endif
 
+#ifndef YY_BATCH_SIZE
+#define YY_BATCH_SIZE 64
+#endif
+
+#ifndef YY_RESET_LIMIT
+#define YY_RESET_LIMIT 65536
+#endif
+
+#ifdef YY_ARENA
+#ifndef YY_ARENA_SIZE
+#define YY_ARENA_SIZE 4096
+#endif
+#ifndef YY_ARENA_ALIGN
+#define YY_ARENA_ALIGN 16
+#endif
+#define YYALLOC(N)	yyArenaAlloc(yy, (N))
+#define YYSTRDUP(S)	yyArenaStrdup(yy, (S))
+#endif
+
+#if defined(YY_PARALLEL) || defined(YY_PIPELINE)
+#include <pthread.h>
+#endif
+#if defined(YY_SAMPLER) && !defined(YY_RULE_STACK)
+#define YY_RULE_STACK 1
+#endif
+#ifdef YY_RULE_STACK
+#ifndef YY_RULE_STACK_SIZE
+#define YY_RULE_STACK_SIZE	256
+#endif
+#define yyStackPush(yy, rule)	do { if (yy->__stackdepth < YY_RULE_STACK_SIZE) yy->__stack[yy->__stackdepth]= (rule);  ++yy->__stackdepth; } while (0)
+#define yyStackPop(yy)		--yy->__stackdepth
+#endif
+#ifdef YY_SAMPLER
+#include <signal.h>
+#include <sys/time.h>
+#ifndef YY_SAMPLER_SIZE
+#define YY_SAMPLER_SIZE	(1 << 18)
+#endif
+#endif
+#ifdef YY_PIPELINE
+#ifndef YY_PIPELINE_DEPTH
+#define YY_PIPELINE_DEPTH 16
+#endif
+#endif
+#ifdef YY_PARALLEL
+#ifndef YY_PARALLEL_CHUNKS
+#define YY_PARALLEL_CHUNKS 4
+#endif
+#endif
+
+#ifdef YY_BUDGET
+#ifndef YY_BUDGET_CLOCK
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#define YY_BUDGET_CLOCK()	yyBudgetClock()
+#define YY_BUDGET_CLOCK_DEFAULT 1
+#endif
+#ifndef YY_BUDGET_INTERVAL
+#define YY_BUDGET_INTERVAL 1024
+#endif
+#endif
+#ifdef YY_RULES_PROFILE
+#ifndef YY_PROFILE_CLOCK
+#if defined(YY_PROFILE_RDTSC) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define YY_PROFILE_CLOCK()	__rdtsc()
+#define YY_PROFILE_UNIT		"cycles"
+#else
+#include <time.h>
+#define YY_PROFILE_CLOCK()	yyProfileClock()
+#define YY_PROFILE_UNIT		"ns"
+#define YY_PROFILE_CLOCK_GETTIME 1
+#endif
+#endif
+#ifndef YY_PROFILE_UNIT
+#define YY_PROFILE_UNIT		"ticks"
+#endif
+#endif
+#if defined(YY_RULES_PROFILE) && !defined(YY_VM)
+#define yyReach(yy)	if (yy->__pos > yy->__alt_reach) yy->__alt_reach= yy->__pos
+#define YY_ALT_TRY(alt)		++yy->__alt_tries[alt];  int yyreach##alt= yy->__alt_reach;  yy->__alt_reach= yy->__pos
+#define YY_ALT_HIT(alt)		++yy->__alt_hits[alt];  if (yyreach##alt > yy->__alt_reach) yy->__alt_reach= yyreach##alt
+#define YY_ALT_MISS(alt, pos)	yy->__alt_waste[alt] += yy->__alt_reach - (pos);  if (yyreach##alt > yy->__alt_reach) yy->__alt_reach= yyreach##alt
+#else
+#define yyReach(yy)
+#define YY_ALT_TRY(alt)
+#define YY_ALT_HIT(alt)
+#define YY_ALT_MISS(alt, pos)
+#endif
+#ifdef YY_HEATMAP
+#define YY_HEAT(yy, pos)	yyHeat(yy, pos)
+#else
+#define YY_HEAT(yy, pos)
+#endif
+#ifdef YY_TRACE
+#ifndef YY_TRACE_SIZE
+#define YY_TRACE_SIZE	1024
+#endif
+#define YY_TRACE_ENTER	0
+#define YY_TRACE_OK	1
+#define YY_TRACE_FAIL	2
+#endif
+#if defined(YY_BUDGET) || defined(YY_MAX_DEPTH)
+#define YY_ABORT_BUDGET	1
+#define YY_ABORT_CANCEL	2
+#define YY_ABORT_DEPTH	3
+#endif
+/* Every rule begins with YY_RULE_PROLOGUE, after saving its start
+ * position, and ends with YY_RULE_EPILOGUE on both its success (ok= 1)
+ * and failure (ok= 0) paths.  Each part is empty unless its feature is
+ * enabled.
+ */
+#ifdef YY_BUDGET
+#define yyRuleBudget(yy)			if (yyBudget(yy)) return 0;
+#else
+#define yyRuleBudget(yy)
+#endif
+#ifdef YY_MAX_DEPTH
+#define yyRuleDepthEnter(yy)			if (yyDepth(yy)) return 0;
+#define yyRuleDepthLeave(yy)			--yy->__depth;
+#else
+#define yyRuleDepthEnter(yy)
+#define yyRuleDepthLeave(yy)
+#endif
+#ifdef YY_RULES_PROFILE
+#define yyRuleProfileEnter(yy, rule)		yyprofile yyprof;  yyProfileEnter(yy, rule, &yyprof);
+#define yyRuleProfileLeave(yy, rule, ok)	++((ok) ? yy->__rules_succeed_count : yy->__rules_fail_count)[rule];  yyProfileLeave(yy, rule, &yyprof);
+#else
+#define yyRuleProfileEnter(yy, rule)
+#define yyRuleProfileLeave(yy, rule, ok)
+#endif
+#ifdef YY_TRACE
+#define yyRuleTraceEnter(yy, rule)		yyTrace(yy, YY_TRACE_ENTER, rule);
+#define yyRuleTraceLeave(yy, rule, ok)		yyTrace(yy, (ok) ? YY_TRACE_OK : YY_TRACE_FAIL, rule);
+#else
+#define yyRuleTraceEnter(yy, rule)
+#define yyRuleTraceLeave(yy, rule, ok)
+#endif
+#ifdef YY_PROBES
+#define yyRuleProbeEnter(yy, rule)		YY_PROBE_RULE_ENTER(yy, rule, yy->__base + yy->__pos);
+#define yyRuleProbeLeave(yy, rule, ok)		YY_PROBE_RULE_EXIT(yy, rule, yy->__base + yy->__pos, ok);
+#else
+#define yyRuleProbeEnter(yy, rule)
+#define yyRuleProbeLeave(yy, rule, ok)
+#endif
+#ifdef YY_RULE_STACK
+#define yyRuleStackEnter(yy, rule)		yyStackPush(yy, rule);
+#define yyRuleStackLeave(yy)			yyStackPop(yy);
+#else
+#define yyRuleStackEnter(yy, rule)
+#define yyRuleStackLeave(yy)
+#endif
+#ifdef YY_EVENTS
+#define yyRuleEventsEnter(yy, rule)		int yyevent= yy->__thunkpos;  yyDo(yy, yyEventEnter, yy->__pos, rule);
+#define yyRuleEventsLeave(yy, ok)		if (ok) yyDo(yy, yyEventLeave, yy->__pos, yyevent);
+#else
+#define yyRuleEventsEnter(yy, rule)
+#define yyRuleEventsLeave(yy, ok)
+#endif
+#ifdef YY_AST
+#define yyRuleAstEnter(yy, rule)		yyDo(yy, yyAstEnter, yy->__pos, rule);
+#define yyRuleAstLeave(yy, ok)			if (ok) yyDo(yy, yyAstLeave, yy->__pos, 0);
+#else
+#define yyRuleAstEnter(yy, rule)
+#define yyRuleAstLeave(yy, ok)
+#endif
+#ifdef YY_DEBUG
+#define yyRuleDebugEnter(yy, rule)		yyDebugEnter(yy, rule);  yyprintf((stderr, "%*.s%s\n", yy->__calldepth - 1, __yyindentspaces, yyrulenames[rule]));
+#define yyRuleDebugLeave(yy, rule, pos, ok)	yyprintf((stderr, "%*.s  %s %s @%d:%d %s\n", yy->__calldepth, __yyindentspaces, (ok) ? "ok  " : "fail", yyrulenames[rule], yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+(pos)));  yyDebugLeave(yy, rule);
+#else
+#define yyRuleDebugEnter(yy, rule)
+#define yyRuleDebugLeave(yy, rule, pos, ok)
+#endif
+#define YY_RULE_PROLOGUE(yy, rule)	\
+  yyRuleBudget(yy) yyRuleDepthEnter(yy) yyRuleProfileEnter(yy, rule) yyRuleTraceEnter(yy, rule) yyRuleProbeEnter(yy, rule)	\
+  yyRuleStackEnter(yy, rule) yyRuleEventsEnter(yy, rule) yyRuleAstEnter(yy, rule) yyRuleDebugEnter(yy, rule)
+#define YY_RULE_EPILOGUE(yy, rule, pos, ok)	\
+  yyRuleProfileLeave(yy, rule, ok) yyRuleDebugLeave(yy, rule, pos, ok) yyRuleAstLeave(yy, ok) yyRuleEventsLeave(yy, ok)	\
+  yyRuleTraceLeave(yy, rule, ok) yyRuleProbeLeave(yy, rule, ok) yyRuleStackLeave(yy) yyRuleDepthLeave(yy)
+
 #ifndef YY_PART
 
 typedef struct _yycontext yycontext;
 typedef void (*yyaction)(yycontext *yy, char *yytext, int yyleng);
 typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;
+#ifdef YY_AST
+typedef struct _yynode { int rule, parent, size, begin, end; } yynode;
+#endif
+#ifdef YY_ARENA
+typedef struct _yyblock { struct _yyblock *next;  size_t size, used;  char data[1]; } yyblock;
+#endif
+#ifdef YY_RULES_PROFILE
+typedef unsigned long long yytime;
+typedef unsigned long long yycount;
+typedef struct _yyprofile { yytime start, child; } yyprofile;
+#endif
+#ifdef YY_TRACE
+typedef struct _yytrace { int pos, depth, rule, kind; } yytrace;
+#endif
+#ifdef YY_VM
+typedef struct _yyframe {
+  int pc, pos, thunkpos, rule;
+#ifdef YY_RULES_PROFILE
+  yyprofile profile;
+#endif
+} yyframe;
+#endif
 
 struct _yycontext {
   char     *__buf;
@@ -125,18 +451,104 @@ struct _yycontext {
   int       __inputpos;
   int       __lineno;
   int       __linenopos;
+  int       __resident;
+#ifdef YY_PIPELINE
+  struct _yypipeline *__pipeline;
+#endif
+#ifdef YY_ARENA
+  yyblock  *__arena;
+  yyblock  *__arenacur;
+#endif
+#ifdef YY_AST
+  yynode   *__ast;
+  int       __astlen;
+  int       __astcount;
+  int       __astparent;
+#endif
+#if defined(YY_AST) || defined(YY_EVENTS) || defined(YY_FIND) || defined(YY_HEATMAP) || defined(YY_TRACE) || defined(YY_DEBUG) || defined(YY_PROBES)
+  int       __base;
+#endif
+#ifdef YY_HEATMAP
+  int      *__heat;
+  char     *__heattext;
+  int       __heatlen;
+  int       __heatsize;
+#endif
+#ifdef YY_RULE_STACK
+  volatile int __stack[YY_RULE_STACK_SIZE];
+  volatile int __stackdepth;
+#endif
+#ifdef YY_SAMPLER
+  int      *__samples;
+  volatile int __sampleslen;
+  volatile int __samplesdropped;
+#endif
+#ifdef YY_TRACE
+  yytrace   __trace[YY_TRACE_SIZE];
+  unsigned long long __tracecount;
+  int       __tracedepth;
+#endif
 #ifdef YY_DEBUG
   char      __escapeCharBuf[4];
+  int       __calldepth;
+  char      __debugrules[YYRULECOUNT+1];
+  int       __debugactive;
+  int       __debugfrom;
+  int       __debugto;
+  int       __debugset;
 #endif
 #ifdef YY_CTX_MEMBERS
   YY_CTX_MEMBERS
 #endif
 #ifdef YY_RULES_PROFILE
-  int       __rules_succeed_count[YYRULECOUNT+1];
-  int       __rules_fail_count[YYRULECOUNT+1];
+  yycount   __rules_succeed_count[YYRULECOUNT+1];
+  yycount   __rules_fail_count[YYRULECOUNT+1];
+  int       __rules_active[YYRULECOUNT+1];
+  yytime    __rules_self_time[YYRULECOUNT+1];
+  yytime    __rules_total_time[YYRULECOUNT+1];
+  yytime    __rules_child;
+  yycount   __rules_input;
+#ifndef YY_VM
+  yycount   __alt_tries[YYALTCOUNT+1];
+  yycount   __alt_hits[YYALTCOUNT+1];
+  yycount   __alt_waste[YYALTCOUNT+1];
+  int       __alt_reach;
+#endif
+#endif
+#if defined(YY_BUDGET) || defined(YY_MAX_DEPTH)
+  int       __abort;
+#endif
+#ifdef YY_BUDGET
+  long      __steps;
+  long      __maxsteps;
+  long long __maxclock;
+  long long __deadline;
+  volatile int *__cancel;
+#endif
+#ifdef YY_MAX_DEPTH
+  int       __depth;
+  int       __maxdepth;
+#endif
+#ifdef YY_VM
+  yyframe  *__frames;
+  int       __frameslen;
+  int       __framepos;
 #endif
 };
 
+#if defined(YY_POOL) && defined(YY_CTX_LOCAL)
+#ifndef YY_POOL_SIZE
+#define YY_POOL_SIZE 64
+#endif
+typedef struct _yypool {
+  yycontext *__contexts[YY_POOL_SIZE];
+  int        __buflen;
+  int        __textlen;
+  int        __thunkslen;
+  int        __valslen;
+} yypool;
+#endif
+
 #ifdef YY_DEBUG
 YY_LOCAL(const char *) yyescapedChar(yycontext *yy, int ch)
 {
@@ -168,8 +580,12 @@ YY_LOCAL(const char *) yyescapedChar(yycontext *yy, int ch)
 #define YY_INPUT(yy, buf, result, max_size)		\
   {							\
     int yyc= getchar();					\
-    result= (EOF == yyc) ? 0 : (*(buf)= yyc, ++yy->__inputpos, 1); \
-    yyprintf((stderr, "<%s>", yyescapedChar(yy, yyc)));\
+    result= (EOF != yyc);\
+    if(result) {\
+      *(buf)= yyc;\
+      ++yy->__inputpos;\
+      yyprintf((stderr, "<%s>\n", yyescapedChar(yy, yyc)));\
+    }\
   }
 #endif
 #else
@@ -183,15 +599,222 @@ yycontext *yyctx= &_yyctx;
 #define YY_INPUT(buf, result, max_size)			\
   {							\
     int yyc= getchar();					\
-    result= (EOF == yyc) ? 0 : (*(buf)= yyc, ++yyctx->__inputpos, 1); \
-    yyprintf((stderr, "<%s>", yyescapedChar(yyctx, yyc)));\
+    result= (EOF != yyc);\
+    if(result) {\
+      *(buf)= yyc;\
+      ++yyctx->__inputpos;\
+      yyprintf((stderr, "<%s>", yyescapedChar(yyctx, yyc)));\
+    }\
   }
 #endif
 #endif
 
+#ifdef YY_RULES_PROFILE
+#ifdef YY_PROFILE_CLOCK_GETTIME
+YY_LOCAL(yytime) yyProfileClock(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (yytime)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+#endif
+
+YY_LOCAL(void) yyProfileEnter(yycontext *yy, int rule, yyprofile *p)
+{
+  p->child= yy->__rules_child;
+  yy->__rules_child= 0;
+  ++yy->__rules_active[rule];
+  p->start= YY_PROFILE_CLOCK();
+}
+
+YY_LOCAL(void) yyProfileLeave(yycontext *yy, int rule, yyprofile *p)
+{
+  yytime elapsed= YY_PROFILE_CLOCK() - p->start;
+  yy->__rules_self_time[rule] += elapsed - yy->__rules_child;
+  if (!--yy->__rules_active[rule])
+    yy->__rules_total_time[rule] += elapsed;
+  yy->__rules_child= p->child + elapsed;
+}
+#endif
+
+#ifdef YY_BUDGET
+#ifdef YY_BUDGET_CLOCK_DEFAULT
+YY_LOCAL(long long) yyBudgetClock(void)
+{
+#ifdef _WIN32
+  LARGE_INTEGER freq, now;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&now);
+  return now.QuadPart / freq.QuadPart * 1000000 + now.QuadPart % freq.QuadPart * 1000000 / freq.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+#endif
+
+YY_LOCAL(int) yyBudget(yycontext *yy)
+{
+  if (yy->__abort) return 1;
+  ++yy->__steps;
+  if (yy->__maxsteps && yy->__steps > yy->__maxsteps)
+    yy->__abort= YY_ABORT_BUDGET;
+  else if (!(yy->__steps % YY_BUDGET_INTERVAL))
+    {
+      if (yy->__cancel && *yy->__cancel)
+        yy->__abort= YY_ABORT_CANCEL;
+      else if (yy->__deadline && YY_BUDGET_CLOCK() > yy->__deadline)
+        yy->__abort= YY_ABORT_BUDGET;
+    }
+  return yy->__abort;
+}
+#endif
+
+#ifdef YY_MAX_DEPTH
+YY_LOCAL(int) yyDepth(yycontext *yy)
+{
+  if (yy->__abort) return 1;
+  if (yy->__depth >= (yy->__maxdepth ? yy->__maxdepth : YY_MAX_DEPTH))
+    {
+      yy->__abort= YY_ABORT_DEPTH;
+      return 1;
+    }
+  ++yy->__depth;
+  return 0;
+}
+#endif
+
+#ifdef YY_ARENA
+YY_LOCAL(void *) yyArenaAlloc(yycontext *yy, size_t size)
+{
+  yyblock *b= yy->__arenacur;
+  char *p;
+  for (;;)
+    {
+      if (b)
+        {
+          p= (char *)(((size_t)(b->data + b->used) + YY_ARENA_ALIGN - 1) & ~(size_t)(YY_ARENA_ALIGN - 1));
+          if (p + size <= b->data + b->size)
+            {
+              b->used= p + size - b->data;
+              yy->__arenacur= b;
+              return p;
+            }
+          if (b->next)
+            {
+              b= b->next;
+              continue;
+            }
+        }
+      {
+        size_t n= size + YY_ARENA_ALIGN > YY_ARENA_SIZE ? size + YY_ARENA_ALIGN : YY_ARENA_SIZE;
+        yyblock *nb= (yyblock *)YY_MALLOC(yy, sizeof(yyblock) + n);
+        nb->next= 0;
+        nb->size= n;
+        nb->used= 0;
+        if (b) b->next= nb; else yy->__arena= nb;
+        b= nb;
+      }
+    }
+}
+
+YY_UNUSED YY_LOCAL(char *) yyArenaStrdup(yycontext *yy, const char *s)
+{
+  size_t n= strlen(s) + 1;
+  return (char *)memcpy(yyArenaAlloc(yy, n), s, n);
+}
+
+YY_LOCAL(void) yyArenaReset(yycontext *yy, size_t keep)
+{
+  yyblock *b= yy->__arena, **link= &yy->__arena;
+  size_t total= 0;
+  while (b)
+    {
+      yyblock *next= b->next;
+      if (total + b->size <= keep)
+        {
+          total += b->size;
+          b->used= 0;
+          *link= b;
+          link= &b->next;
+        }
+      else
+        YY_FREE(yy, b);
+      b= next;
+    }
+  *link= 0;
+  yy->__arenacur= yy->__arena;
+}
+#endif
+
+#ifdef YY_HEATMAP
+YY_LOCAL(void) yyHeatInput(yycontext *yy, int from, int length)
+{
+  int offset= yy->__base + from;
+  if (offset + length > yy->__heatsize)
+    {
+      int size= yy->__heatsize ? yy->__heatsize : YY_BUFFER_SIZE;
+      while (size < offset + length) size *= 2;
+      yy->__heat= (int *)YY_REALLOC(yy, yy->__heat, sizeof(int) * size);
+      yy->__heattext= (char *)YY_REALLOC(yy, yy->__heattext, size);
+      yy->__heatsize= size;
+    }
+  memset(yy->__heat + offset, 0, sizeof(int) * length);
+  memcpy(yy->__heattext + offset, yy->__buf + from, length);
+  yy->__heatlen= offset + length;
+}
+
+YY_LOCAL(void) yyHeat(yycontext *yy, int pos)
+{
+  int i= yy->__base + pos, e= yy->__base + yy->__pos;
+  if (e > yy->__heatlen) e= yy->__heatlen;
+  while (i < e) ++yy->__heat[i++];
+}
+#endif
+
+#ifdef YY_RULE_STACK
+YY_PARSE(int) yyShowRuleStack(yycontext *yy, FILE *fp);
+#endif
+
+#ifdef YY_SAMPLER
+YY_PARSE(void) yyStopSampler(yycontext *yy);
+
+static yycontext *yysampled= 0;	/* the one context being sampled */
+
+YY_LOCAL(void) yySampleSignal(int sig)
+{
+  yycontext *yy= yysampled;
+  int depth, i;
+  if (!yy || !(depth= yy->__stackdepth)) return;
+  if (depth > YY_RULE_STACK_SIZE) depth= YY_RULE_STACK_SIZE;
+  if (yy->__sampleslen + depth + 1 > YY_SAMPLER_SIZE)
+    {
+      ++yy->__samplesdropped;
+      return;
+    }
+  yy->__samples[yy->__sampleslen]= depth;
+  for (i= 0;  i < depth;  ++i)
+    yy->__samples[yy->__sampleslen + 1 + i]= yy->__stack[i];
+  yy->__sampleslen += depth + 1;
+}
+#endif
+
+#ifdef YY_TRACE
+YY_LOCAL(void) yyTrace(yycontext *yy, int kind, int rule)
+{
+  yytrace *t= &yy->__trace[yy->__tracecount++ % YY_TRACE_SIZE];
+  t->pos= yy->__base + yy->__pos;
+  t->depth= (YY_TRACE_ENTER == kind) ? yy->__tracedepth++ : --yy->__tracedepth;
+  t->rule= rule;
+  t->kind= kind;
+}
+#endif
+
 YY_LOCAL(int) yyrefill(yycontext *yy)
 {
   int yyn;
+  if (yy->__resident) return 0;
   while (yy->__buflen - yy->__pos < 512)
     {
 #ifdef YY_DEBUG
@@ -211,6 +834,15 @@ YY_LOCAL(int) yyrefill(yycontext *yy)
 #endif
   if (!yyn) return 0;
   yy->__limit += yyn;
+#ifdef YY_RULES_PROFILE
+  yy->__rules_input += yyn;
+#endif
+#ifdef YY_HEATMAP
+  yyHeatInput(yy, yy->__limit - yyn, yyn);
+#endif
+#ifdef YY_PROBES
+  YY_PROBE_REFILL(yy, yy->__base + yy->__limit - yyn, yyn);
+#endif
   return 1;
 }
 
@@ -218,6 +850,7 @@ YY_LOCAL(int) yymatchDot(yycontext *yy)
 {
   if (yy->__pos >= yy->__limit && !yyrefill(yy)) return 0;
   ++yy->__pos;
+  yyReach(yy);
   return 1;
 }
 
@@ -227,10 +860,11 @@ YY_LOCAL(int) yymatchChar(yycontext *yy, int c)
   if ((unsigned char)yy->__buf[yy->__pos] == c)
     {
       ++yy->__pos;
-      yyprintf((stderr, "  ok   yymatchChar(yy, %s) @%d:%d %s\n", yyescapedChar(yy, c), yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+      yyReach(yy);
+      yyprintf((stderr, "%*.s  ok   yymatchChar(yy, %s) @%d:%d %s\n", yy->__calldepth, __yyindentspaces, yyescapedChar(yy, c), yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
       return 1;
     }
-  yyprintf((stderr, "  fail yymatchChar(yy, %s) @%d:%d %s\n", yyescapedChar(yy, c), yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  yyprintf((stderr, "%*.s  fail yymatchChar(yy, %s) @%d:%d %s\n", yy->__calldepth, __yyindentspaces, yyescapedChar(yy, c), yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
   return 0;
 }
 
@@ -240,10 +874,11 @@ YY_LOCAL(int) yymatchCharCaseInsensitive(yycontext *yy, int c)
   if (tolower(yy->__buf[yy->__pos]) == tolower(c))
     {
       ++yy->__pos;
-      yyprintf((stderr, "  ok   yymatchCharCaseInsensitive(yy, %s) @%d:%d %s\n", yyescapedChar(yy, c), yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+      yyReach(yy);
+      yyprintf((stderr, "%*.s  ok   yymatchCharCaseInsensitive(yy, %s) @%d:%d %s\n", yy->__calldepth, __yyindentspaces, yyescapedChar(yy, c), yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
       return 1;
     }
-  yyprintf((stderr, "  fail yymatchCharCaseInsensitive(yy, %s) @%d:%d %s\n", yyescapedChar(yy, c), yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  yyprintf((stderr, "%*.s  fail yymatchCharCaseInsensitive(yy, %s) @%d:%d %s\n", yy->__calldepth, __yyindentspaces, yyescapedChar(yy, c), yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
   return 0;
 }
 
@@ -261,6 +896,7 @@ YY_LOCAL(int) yymatchString(yycontext *yy, const char *s)
       ++s;
       ++yy->__pos;
     }
+  yyReach(yy);
   return 1;
 }
 
@@ -278,6 +914,7 @@ YY_LOCAL(int) yymatchStringCaseInsensitive(yycontext *yy, const char *s)
       ++s;
       ++yy->__pos;
     }
+  yyReach(yy);
   return 1;
 }
 
@@ -289,10 +926,11 @@ YY_LOCAL(int) yymatchClass(yycontext *yy, unsigned char *bits)
   if (bits[c >> 3] & (1 << (c & 7)))
     {
       ++yy->__pos;
-      yyprintf((stderr, "  ok   yymatchClass @%d:%d %s\n", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+      yyReach(yy);
+      yyprintf((stderr, "%*.s  ok   yymatchClass @%d:%d %s\n", yy->__calldepth, __yyindentspaces, yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
       return 1;
     }
-  yyprintf((stderr, "  fail yymatchClass @%d:%d %s\n", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  yyprintf((stderr, "%*.s  fail yymatchClass @%d:%d %s\n", yy->__calldepth, __yyindentspaces, yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
   return 0;
 }
 
@@ -304,13 +942,15 @@ YY_LOCAL(int) yymatchClassCaseInsensitive(yycontext *yy, unsigned char *bits)
   if (bits[c >> 3] & (1 << (c & 7)))
     {
       ++yy->__pos;
-      yyprintf((stderr, "  ok   yymatchClassCaseInsensitive @%d:%d %s\n", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+      yyReach(yy);
+      yyprintf((stderr, "%*.s  ok   yymatchClassCaseInsensitive @%d:%d %s\n", yy->__calldepth, __yyindentspaces, yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
       return 1;
     }
-  yyprintf((stderr, "  fail yymatchClassCaseInsensitive @%d:%d %s\n", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  yyprintf((stderr, "%*.s  fail yymatchClassCaseInsensitive @%d:%d %s\n", yy->__calldepth, __yyindentspaces, yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
   return 0;
 }
 
+#if !defined(YY_RECOGNIZER) || defined(YY_VM) || defined(YY_EVENTS) || defined(YY_AST)
 YY_LOCAL(void) yyDo(yycontext *yy, yyaction action, int begin, int end)
 {
   while (yy->__thunkpos >= yy->__thunkslen)
@@ -323,6 +963,7 @@ YY_LOCAL(void) yyDo(yycontext *yy, yyaction action, int begin, int end)
   yy->__thunks[yy->__thunkpos].action= action;
   ++yy->__thunkpos;
 }
+#endif
 
 YY_LOCAL(int) yyText(yycontext *yy, int begin, int end)
 {
@@ -342,60 +983,282 @@ YY_LOCAL(int) yyText(yycontext *yy, int begin, int end)
   return yyleng;
 }
 
-YY_LOCAL(void) yyDone(yycontext *yy)
+#ifdef YY_PIPELINE
+typedef struct _yyentry { yyaction action;  int text, leng; } yyentry;
+
+typedef struct _yybatch {
+  yyentry  *__entries;
+  int       __entrieslen;
+  int       __count;
+  char     *__text;
+  int       __textlen;
+  int       __textpos;
+  int       __reset;
+} yybatch;
+
+typedef struct _yypipeline {
+  yycontext *__ctx;
+  pthread_t  __consumer;
+  yybatch   *__full[YY_PIPELINE_DEPTH];
+  unsigned   __fullhead, __fulltail;
+  yybatch   *__free[YY_PIPELINE_DEPTH];
+  unsigned   __freehead, __freetail;
+  yybatch   *__batches[YY_PIPELINE_DEPTH];
+  int        __count;
+  int        __reset;
+  int        __stop;
+  pthread_mutex_t __lock;
+  pthread_cond_t  __fullcond, __freecond;
+} yypipeline;
+
+YY_LOCAL(void) yyPipelinePut(yypipeline *p, yybatch **ring, unsigned *tail, pthread_cond_t *cond, yybatch *batch)
 {
-  int pos;
+  pthread_mutex_lock(&p->__lock);
+  ring[*tail % YY_PIPELINE_DEPTH]= batch;
+  ++*tail;
+  pthread_cond_signal(cond);
+  pthread_mutex_unlock(&p->__lock);
+}
+
+/* take the next batch from ring; if wait, block until one arrives or the pipeline stops */
+YY_LOCAL(yybatch *) yyPipelineGet(yypipeline *p, yybatch **ring, unsigned *head, unsigned *tail, pthread_cond_t *cond, int wait)
+{
+  yybatch *batch= 0;
+  pthread_mutex_lock(&p->__lock);
+  while (wait && *head == *tail && !p->__stop)
+    pthread_cond_wait(cond, &p->__lock);
+  if (*head != *tail)
+    batch= ring[(*head)++ % YY_PIPELINE_DEPTH];
+  pthread_mutex_unlock(&p->__lock);
+  return batch;
+}
+
+#ifdef YY_AST
+YY_LOCAL(int) yyAstThunk(yycontext *yy, yythunk *thunk);
+#endif
+#ifdef YY_EVENTS
+YY_LOCAL(int) yyEventThunk(yycontext *yy, yythunk *thunk);
+#endif
+
+YY_LOCAL(void) yyPipelineDone(yycontext *yy)
+{
+  yypipeline *p= yy->__pipeline;
+  yybatch *b;
+  int pos, count= 0;
+  if (!(b= yyPipelineGet(p, p->__free, &p->__freehead, &p->__freetail, &p->__freecond, 0)))
+    {
+      if (p->__count < YY_PIPELINE_DEPTH)
+        {
+          b= p->__batches[p->__count++]= (yybatch *)YY_MALLOC(yy, sizeof(yybatch));
+          b->__entrieslen= YY_STACK_SIZE;
+          b->__entries= (yyentry *)YY_MALLOC(yy, sizeof(yyentry) * b->__entrieslen);
+          b->__textlen= YY_BUFFER_SIZE;
+          b->__text= (char *)YY_MALLOC(yy, b->__textlen);
+        }
+      else
+        b= yyPipelineGet(p, p->__free, &p->__freehead, &p->__freetail, &p->__freecond, 1);
+    }
+  if (b->__entrieslen < yy->__thunkpos)
+    {
+      while (b->__entrieslen < yy->__thunkpos) b->__entrieslen *= 2;
+      b->__entries= (yyentry *)YY_REALLOC(yy, b->__entries, sizeof(yyentry) * b->__entrieslen);
+    }
+  b->__textpos= 0;
+  b->__reset= p->__reset;
+  p->__reset= 0;
   for (pos= 0;  pos < yy->__thunkpos;  ++pos)
     {
       yythunk *thunk= &yy->__thunks[pos];
-      int yyleng= thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;
-      yyprintf((stderr, "DO [%d] %p %s\n", pos, thunk->action, yy->__text));
-      thunk->action(yy, yy->__text, yyleng);
+      yyentry *e;
+      /* tree and event thunks hold a rule id in end: handle them here, not as text */
+#ifdef YY_AST
+      if (yyAstThunk(yy, thunk)) continue;
+#endif
+#ifdef YY_EVENTS
+      if (yyEventThunk(yy, thunk)) continue;
+#endif
+      e= &b->__entries[count++];
+      e->action= thunk->action;
+      if (!thunk->end)
+        {
+          e->text= -1;
+          e->leng= thunk->begin;
+          continue;
+        }
+      e->leng= thunk->end > thunk->begin ? thunk->end - thunk->begin : 0;
+      while (b->__textlen < b->__textpos + e->leng + 1)
+        {
+          b->__textlen *= 2;
+          b->__text= (char *)YY_REALLOC(yy, b->__text, b->__textlen);
+        }
+      e->text= b->__textpos;
+      memcpy(b->__text + b->__textpos, yy->__buf + thunk->begin, e->leng);
+      b->__text[b->__textpos + e->leng]= '\0';
+      b->__textpos += e->leng + 1;
     }
+  b->__count= count;
+  yyPipelinePut(p, p->__full, &p->__fulltail, &p->__fullcond, b);
   yy->__thunkpos= 0;
 }
+#endif
 
-YY_LOCAL(void) yyCommit(yycontext *yy)
+YY_LOCAL(void) yyValReset(yycontext *yy)
 {
-  if (yy->__pos > 0) {
-    if ((yy->__limit -= yy->__pos)) {
-      memmove(yy->__buf, yy->__buf + yy->__pos, yy->__limit);
+#ifdef YY_PIPELINE
+  if (yy->__pipeline)
+    {
+      yy->__pipeline->__reset= 1;
+      return;
     }
-    yy->__begin -= yy->__pos;
-    yy->__end -= yy->__pos;
-    yy->__pos= 0;
-  }
-  yy->__thunkpos= 0;
+#endif
+  yy->__val= yy->__vals;
 }
 
-YY_LOCAL(int) yyAccept(yycontext *yy, int tp0)
+#ifdef YY_AST
+YY_LOCAL(void) yyAstEnter(yycontext *yy, char *yytext, int yyleng)	{}
+YY_LOCAL(void) yyAstLeave(yycontext *yy, char *yytext, int yyleng)	{}
+YY_LOCAL(void) yyAstCapture(yycontext *yy, char *yytext, int yyleng)	{}
+
+YY_LOCAL(int) yyAstThunk(yycontext *yy, yythunk *thunk)
 {
-  if (tp0)
+  yynode *node;
+  if (thunk->action == yyAstLeave)
     {
-      fprintf(stderr, "accept denied at %d\n", tp0);
-      return 0;
+      node= &yy->__ast[yy->__astparent];
+      node->end= yy->__base + thunk->begin;
+      node->size= yy->__astcount - yy->__astparent;
+      yy->__astparent= node->parent;
+      return 1;
+    }
+  if (thunk->action != yyAstEnter && thunk->action != yyAstCapture)
+    return 0;
+  if (yy->__astcount >= yy->__astlen)
+    {
+      yy->__astlen= yy->__astlen ? yy->__astlen * 2 : YY_STACK_SIZE;
+      yy->__ast= (yynode *)YY_REALLOC(yy, yy->__ast, sizeof(yynode) * yy->__astlen);
+    }
+  node= &yy->__ast[yy->__astcount];
+  node->parent= yy->__astparent;
+  node->begin= yy->__base + thunk->begin;
+  if (thunk->action == yyAstEnter)
+    {
+      node->rule= thunk->end;
+      yy->__astparent= yy->__astcount;
     }
   else
     {
-      yyDone(yy);
-      yyCommit(yy);
+      node->rule= 0;
+      node->size= 1;
+      node->end= yy->__base + thunk->end;
     }
+  ++yy->__astcount;
   return 1;
 }
+#endif
 
-YY_LOCAL(void) yyPush(yycontext *yy, char *text, int count)
+#ifdef YY_EVENTS
+static const char *const yyrulenames[YYRULECOUNT+1];
+
+YY_LOCAL(void) yyEventEnter(yycontext *yy, char *yytext, int yyleng)	{}
+YY_LOCAL(void) yyEventLeave(yycontext *yy, char *yytext, int yyleng)	{}
+
+YY_LOCAL(int) yyEventThunk(yycontext *yy, yythunk *thunk)
 {
-  yy->__val += count;
-  while (yy->__valslen <= yy->__val - yy->__vals)
+  if (thunk->action == yyEventEnter)
     {
-      long offset= yy->__val - yy->__vals;
-      yy->__valslen *= 2;
-      yy->__vals= (YYSTYPE *)YY_REALLOC(yy, yy->__vals, sizeof(YYSTYPE) * yy->__valslen);
-      yy->__val= yy->__vals + offset;
+      YY_RULE_ENTER(yy, thunk->end, yy->__base + thunk->begin);
+      return 1;
+    }
+  if (thunk->action == yyEventLeave)
+    {
+      yythunk *enter= &yy->__thunks[thunk->end];
+      (void)enter;
+      YY_RULE_EXIT(yy, enter->end, yy->__base + enter->begin, yy->__base + thunk->begin);
+      return 1;
+    }
+  return 0;
+}
+#endif
+
+YY_LOCAL(void) yyDone(yycontext *yy)
+{
+  int pos;
+#ifdef YY_PIPELINE
+  if (yy->__pipeline)
+    {
+      yyPipelineDone(yy);
+      return;
+    }
+#endif
+  for (pos= 0;  pos < yy->__thunkpos;  ++pos)
+    {
+      yythunk *thunk= &yy->__thunks[pos];
+      int yyleng;
+#ifdef YY_AST
+      if (yyAstThunk(yy, thunk)) continue;
+#endif
+#ifdef YY_EVENTS
+      if (yyEventThunk(yy, thunk)) continue;
+#endif
+      yyleng= thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;
+      yyprintf((stderr, "DO [%d] %p %s\n", pos, thunk->action, yy->__text));
+#ifdef YY_PROBES
+      YY_PROBE_ACTION(yy, thunk->action, yy->__base + thunk->begin, yy->__base + thunk->end);
+#endif
+      thunk->action(yy, yy->__text, yyleng);
+    }
+  yy->__thunkpos= 0;
+}
+
+YY_LOCAL(void) yyCommit(yycontext *yy)
+{
+  if (yy->__pos > 0) {
+#if defined(YY_AST) || defined(YY_EVENTS) || defined(YY_FIND) || defined(YY_HEATMAP) || defined(YY_TRACE) || defined(YY_DEBUG) || defined(YY_PROBES)
+    yy->__base += yy->__pos;
+#endif
+    if ((yy->__limit -= yy->__pos)) {
+      memmove(yy->__buf, yy->__buf + yy->__pos, yy->__limit);
+    }
+#ifdef YY_PROBES
+    YY_PROBE_COMMIT(yy, yy->__base, yy->__limit);
+#endif
+    yy->__begin -= yy->__pos;
+    yy->__end -= yy->__pos;
+    yy->__pos= 0;
+  }
+  yy->__thunkpos= 0;
+}
+
+YY_UNUSED YY_LOCAL(int) yyAccept(yycontext *yy, int tp0)
+{
+  if (tp0)
+    {
+      fprintf(stderr, "accept denied at %d\n", tp0);
+      return 0;
+    }
+  else
+    {
+      yyDone(yy);
+      yyCommit(yy);
+    }
+  return 1;
+}
+
+#if !defined(YY_RECOGNIZER) || defined(YY_VM)
+YY_LOCAL(void) yyPush(yycontext *yy, char *text, int count)
+{
+  yy->__val += count;
+  while (yy->__valslen <= yy->__val - yy->__vals)
+    {
+      long offset= yy->__val - yy->__vals;
+      yy->__valslen *= 2;
+      yy->__vals= (YYSTYPE *)YY_REALLOC(yy, yy->__vals, sizeof(YYSTYPE) * yy->__valslen);
+      yy->__val= yy->__vals + offset;
     }
 }
 YY_LOCAL(void) yyPop(yycontext *yy, char *text, int count)   { yy->__val -= count; }
 YY_LOCAL(void) yySet(yycontext *yy, char *text, int count)   { yy->__val[count]= yy->__; }
+#endif
 
 #endif /* YY_PART */
 
@@ -444,8 +1307,8 @@ YY_RULE(int) yy_declaration(yycontext *yy); /* 3 */
 YY_RULE(int) yy__(yycontext *yy); /* 2 */
 YY_RULE(int) yy_grammar(yycontext *yy); /* 1 */
 
-#ifdef YY_RULES_PROFILE
-static const char *yyrulenames[YYRULECOUNT+1] = {
+#if defined(YY_RULES_PROFILE) || defined(YY_DEBUG) || defined(YY_AST) || defined(YY_EVENTS) || defined(YY_TRACE) || defined(YY_PROBES) || defined(YY_RULE_STACK)
+static const char *const yyrulenames[YYRULECOUNT+1] = {
 NULL,
 "grammar", /* 1 */
 "_", /* 2 */
@@ -490,6 +1353,145 @@ NULL,
 "space", /* 41 */
 "comment", /* 42 */
 
+};
+#endif
+#ifdef YY_RULES_PROFILE
+static const int yyrulelines[YYRULECOUNT+1] = {
+0,
+68, /* grammar */
+169, /* _ */
+70, /* declaration */
+77, /* definition */
+74, /* trailer */
+177, /* end_of_file */
+176, /* end_of_line */
+167, /* RPERCENT */
+123, /* identifier */
+151, /* EQUAL */
+83, /* expression */
+153, /* SEMICOLON */
+86, /* sequence */
+154, /* BAR */
+89, /* error */
+93, /* prefix */
+166, /* TILDE */
+141, /* action */
+157, /* AT */
+155, /* AND */
+99, /* suffix */
+156, /* NOT */
+104, /* primary */
+158, /* QUESTION */
+159, /* STAR */
+160, /* PLUS */
+152, /* COLON */
+161, /* OPEN */
+162, /* CLOSE */
+126, /* literalSQ */
+127, /* literalDQ */
+124, /* identstart */
+129, /* class */
+163, /* DOT */
+164, /* BEGIN */
+165, /* END */
+133, /* char */
+131, /* range */
+144, /* braces */
+148, /* literalBraces */
+170, /* space */
+171, /* comment */
+};
+#endif
+#ifdef YY_FIND
+static int (*const yyfindrules[YYRULECOUNT+1])(yycontext *)= {
+  0,
+  yy_grammar,
+  yy__,
+  yy_declaration,
+  yy_definition,
+  yy_trailer,
+  yy_end_of_file,
+  yy_end_of_line,
+  yy_RPERCENT,
+  yy_identifier,
+  yy_EQUAL,
+  yy_expression,
+  yy_SEMICOLON,
+  yy_sequence,
+  yy_BAR,
+  yy_error,
+  yy_prefix,
+  yy_TILDE,
+  yy_action,
+  yy_AT,
+  yy_AND,
+  yy_suffix,
+  yy_NOT,
+  yy_primary,
+  yy_QUESTION,
+  yy_STAR,
+  yy_PLUS,
+  yy_COLON,
+  yy_OPEN,
+  yy_CLOSE,
+  yy_literalSQ,
+  yy_literalDQ,
+  yy_identstart,
+  yy_class,
+  yy_DOT,
+  yy_BEGIN,
+  yy_END,
+  yy_char,
+  yy_range,
+  yy_braces,
+  yy_literalBraces,
+  yy_space,
+  yy_comment,
+};
+static const char *const yyfirstsets[YYRULECOUNT+1]= {
+  0,
+  "\000\046\000\000\051\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  0,
+  "\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  0,
+  "\000\044\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\306\141\000\120\377\377\377\217\376\377\377\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\306\141\000\120\377\377\377\217\376\377\377\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\306\141\000\120\377\377\377\217\376\377\377\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\306\141\000\120\377\377\377\217\376\377\377\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\204\141\000\120\376\377\377\217\376\377\377\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\204\141\000\120\376\377\377\217\376\377\377\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377",
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377",
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377",
+  "\000\000\000\000\204\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\046\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
 };
 #endif
 YY_ACTION(void) yy_1_end_of_line(yycontext *yy, char *yytext, int yyleng)
@@ -499,7 +1501,7 @@ YY_ACTION(void) yy_1_end_of_line(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_end_of_line\n"));
   {
-#line 172
+#line 176
    ++lineNumber; lineNumberPos=inputPos; ;
   }
 #undef yythunkpos
@@ -513,7 +1515,7 @@ YY_ACTION(void) yy_1_action(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_action\n"));
   {
-#line 137
+#line 141
    actionLine= lineNumber; ;
   }
 #undef yythunkpos
@@ -527,7 +1529,7 @@ YY_ACTION(void) yy_12_primary(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_12_primary\n"));
   {
-#line 115
+#line 119
    push(makePredicate("YY_END")); ;
   }
 #undef yythunkpos
@@ -541,7 +1543,7 @@ YY_ACTION(void) yy_11_primary(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_11_primary\n"));
   {
-#line 114
+#line 118
    push(makePredicate("YY_BEGIN")); ;
   }
 #undef yythunkpos
@@ -555,7 +1557,7 @@ YY_ACTION(void) yy_10_primary(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_10_primary\n"));
   {
-#line 113
+#line 117
    push(makeAction(actionLine, yytext)); ;
   }
 #undef yythunkpos
@@ -569,7 +1571,7 @@ YY_ACTION(void) yy_9_primary(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_9_primary\n"));
   {
-#line 112
+#line 116
    push(makeDot()); ;
   }
 #undef yythunkpos
@@ -583,7 +1585,7 @@ YY_ACTION(void) yy_8_primary(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_8_primary\n"));
   {
-#line 111
+#line 115
    setTopClassCharCaseInsensitive(); ;
   }
 #undef yythunkpos
@@ -597,7 +1599,7 @@ YY_ACTION(void) yy_7_primary(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_7_primary\n"));
   {
-#line 110
+#line 114
    push(makeClass(yytext)); ;
   }
 #undef yythunkpos
@@ -611,7 +1613,7 @@ YY_ACTION(void) yy_6_primary(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_6_primary\n"));
   {
-#line 109
+#line 113
    setTopStrCharCaseInsensitive(); ;
   }
 #undef yythunkpos
@@ -625,7 +1627,7 @@ YY_ACTION(void) yy_5_primary(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_5_primary\n"));
   {
-#line 108
+#line 112
    push(makeString(yytext, '"')); ;
   }
 #undef yythunkpos
@@ -639,7 +1641,7 @@ YY_ACTION(void) yy_4_primary(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_4_primary\n"));
   {
-#line 107
+#line 111
    push(makeString(yytext, '\'')); ;
   }
 #undef yythunkpos
@@ -653,7 +1655,7 @@ YY_ACTION(void) yy_3_primary(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_3_primary\n"));
   {
-#line 103
+#line 107
    push(makeName(findRule(yytext))); ;
   }
 #undef yythunkpos
@@ -667,7 +1669,7 @@ YY_ACTION(void) yy_2_primary(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_2_primary\n"));
   {
-#line 102
+#line 106
    Node *name= makeName(findRule(yytext));  name->name.variable= pop();  push(name); ;
   }
 #undef yythunkpos
@@ -681,7 +1683,7 @@ YY_ACTION(void) yy_1_primary(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_primary\n"));
   {
-#line 101
+#line 105
    push(makeVariable(yytext)); ;
   }
 #undef yythunkpos
@@ -695,7 +1697,7 @@ YY_ACTION(void) yy_3_suffix(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_3_suffix\n"));
   {
-#line 97
+#line 101
    push(makePlus (pop())); ;
   }
 #undef yythunkpos
@@ -709,7 +1711,7 @@ YY_ACTION(void) yy_2_suffix(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_2_suffix\n"));
   {
-#line 96
+#line 100
    push(makeStar (pop())); ;
   }
 #undef yythunkpos
@@ -723,7 +1725,7 @@ YY_ACTION(void) yy_1_suffix(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_suffix\n"));
   {
-#line 95
+#line 99
    push(makeQuery(pop())); ;
   }
 #undef yythunkpos
@@ -737,7 +1739,7 @@ YY_ACTION(void) yy_4_prefix(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_4_prefix\n"));
   {
-#line 92
+#line 96
    push(makePeekNot(pop())); ;
   }
 #undef yythunkpos
@@ -751,7 +1753,7 @@ YY_ACTION(void) yy_3_prefix(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_3_prefix\n"));
   {
-#line 91
+#line 95
    push(makePeekFor(pop())); ;
   }
 #undef yythunkpos
@@ -765,7 +1767,7 @@ YY_ACTION(void) yy_2_prefix(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_2_prefix\n"));
   {
-#line 90
+#line 94
    push(makePredicate(yytext)); ;
   }
 #undef yythunkpos
@@ -779,7 +1781,7 @@ YY_ACTION(void) yy_1_prefix(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_prefix\n"));
   {
-#line 89
+#line 93
    push(makeInline(yytext)); ;
   }
 #undef yythunkpos
@@ -793,7 +1795,7 @@ YY_ACTION(void) yy_1_error(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_error\n"));
   {
-#line 85
+#line 89
    push(makeError(pop(), yytext)); ;
   }
 #undef yythunkpos
@@ -807,7 +1809,7 @@ YY_ACTION(void) yy_1_sequence(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_sequence\n"));
   {
-#line 82
+#line 86
    Node *f= pop();  push(Sequence_append(pop(), f)); ;
   }
 #undef yythunkpos
@@ -821,7 +1823,7 @@ YY_ACTION(void) yy_1_expression(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_expression\n"));
   {
-#line 79
+#line 83
    Node *f= pop();  push(Alternate_append(pop(), f)); ;
   }
 #undef yythunkpos
@@ -835,7 +1837,7 @@ YY_ACTION(void) yy_3_definition(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_3_definition\n"));
   {
-#line 76
+#line 80
    Node *e= pop();  Rule_setExpression(pop(), e); ;
   }
 #undef yythunkpos
@@ -849,7 +1851,7 @@ YY_ACTION(void) yy_2_definition(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_2_definition\n"));
   {
-#line 74
+#line 78
    if (push(beginRule(findRule(yytext), headerLine))->rule.expression)
 							    fprintf(stderr, "rule '%s' redefined\n", yytext); ;
   }
@@ -864,7 +1866,7 @@ YY_ACTION(void) yy_1_definition(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_definition\n"));
   {
-#line 73
+#line 77
    headerLine= lineNumber ;
   }
 #undef yythunkpos
@@ -878,7 +1880,7 @@ YY_ACTION(void) yy_2_trailer(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_2_trailer\n"));
   {
-#line 71
+#line 75
    trailer = makeTrailer(headerLine, yytext); ;
   }
 #undef yythunkpos
@@ -892,7 +1894,7 @@ YY_ACTION(void) yy_1_trailer(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_trailer\n"));
   {
-#line 70
+#line 74
    headerLine= lineNumber ;
   }
 #undef yythunkpos
@@ -906,7 +1908,7 @@ YY_ACTION(void) yy_2_declaration(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_2_declaration\n"));
   {
-#line 68
+#line 72
    headers = makeHeader(headers, headerLine, yytext); ;
   }
 #undef yythunkpos
@@ -920,7 +1922,7 @@ YY_ACTION(void) yy_1_declaration(yycontext *yy, char *yytext, int yyleng)
 #define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_declaration\n"));
   {
-#line 66
+#line 70
    headerLine= lineNumber; ;
   }
 #undef yythunkpos
@@ -930,1010 +1932,963 @@ YY_ACTION(void) yy_1_declaration(yycontext *yy, char *yytext, int yyleng)
 
 YY_RULE(int) yy_comment(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "comment"));  if (!yymatchChar(yy, '#')) goto l1;
-  {  int yypos2= yy->__pos, yythunkpos2= yy->__thunkpos;  if (!yymatchString(yy, ">>#")) goto l3;
+  YY_RULE_PROLOGUE(yy, 42);  if (!yymatchChar(yy, '#')) goto l1;
+  {  int yypos2= yy->__pos, yythunkpos2= yy->__thunkpos;
+  YY_ALT_TRY(1);  if (!yymatchString(yy, ">>#")) goto l3;
   l4:;	
   {  int yypos5= yy->__pos, yythunkpos5= yy->__thunkpos;
   {  int yypos6= yy->__pos, yythunkpos6= yy->__thunkpos;  if (!yymatchString(yy, "#<<#")) goto l6;  goto l5;
-  l6:;	  yy->__pos= yypos6; yy->__thunkpos= yythunkpos6;
+  l6:;	  YY_HEAT(yy, yypos6);  yy->__pos= yypos6; yy->__thunkpos= yythunkpos6;
   }
-  {  int yypos7= yy->__pos, yythunkpos7= yy->__thunkpos;  if (!yy_end_of_line(yy)) goto l8;  goto l7;
-  l8:;	  yy->__pos= yypos7; yy->__thunkpos= yythunkpos7;  if (!yymatchDot(yy)) goto l5;
+  {  int yypos7= yy->__pos, yythunkpos7= yy->__thunkpos;
+  YY_ALT_TRY(4);  if (!yy_end_of_line(yy)) goto l8;  YY_ALT_HIT(4);  goto l7;
+  l8:;	  YY_ALT_MISS(4, yypos7);  YY_HEAT(yy, yypos7);  yy->__pos= yypos7; yy->__thunkpos= yythunkpos7;
+  YY_ALT_TRY(5);  if (!yymatchDot(yy)) goto l9;  YY_ALT_HIT(5);  goto l7;
+  l9:;	  YY_ALT_MISS(5, yypos7);  goto l5;
   }
   l7:;	  goto l4;
-  l5:;	  yy->__pos= yypos5; yy->__thunkpos= yythunkpos5;
-  }  if (!yymatchString(yy, "#<<#")) goto l3;  goto l2;
-  l3:;	  yy->__pos= yypos2; yy->__thunkpos= yythunkpos2;  if (!yymatchString(yy, ">=>#")) goto l9;
-  l10:;	
-  {  int yypos11= yy->__pos, yythunkpos11= yy->__thunkpos;
-  {  int yypos12= yy->__pos, yythunkpos12= yy->__thunkpos;  if (!yymatchString(yy, "#<=<#")) goto l12;  goto l11;
-  l12:;	  yy->__pos= yypos12; yy->__thunkpos= yythunkpos12;
-  }  if (!yymatchDot(yy)) goto l11;  goto l10;
-  l11:;	  yy->__pos= yypos11; yy->__thunkpos= yythunkpos11;
-  }  if (!yymatchString(yy, "#<=<#")) goto l9;  goto l2;
-  l9:;	  yy->__pos= yypos2; yy->__thunkpos= yythunkpos2;
-  l13:;	
-  {  int yypos14= yy->__pos, yythunkpos14= yy->__thunkpos;
-  {  int yypos15= yy->__pos, yythunkpos15= yy->__thunkpos;  if (!yy_end_of_line(yy)) goto l15;  goto l14;
-  l15:;	  yy->__pos= yypos15; yy->__thunkpos= yythunkpos15;
-  }  if (!yymatchDot(yy)) goto l14;  goto l13;
-  l14:;	  yy->__pos= yypos14; yy->__thunkpos= yythunkpos14;
-  }  if (!yy_end_of_line(yy)) goto l1;
+  l5:;	  YY_HEAT(yy, yypos5);  yy->__pos= yypos5; yy->__thunkpos= yythunkpos5;
+  }  if (!yymatchString(yy, "#<<#")) goto l3;  YY_ALT_HIT(1);  goto l2;
+  l3:;	  YY_ALT_MISS(1, yypos2);  YY_HEAT(yy, yypos2);  yy->__pos= yypos2; yy->__thunkpos= yythunkpos2;
+  YY_ALT_TRY(2);  if (!yymatchString(yy, ">=>#")) goto l10;
+  l11:;	
+  {  int yypos12= yy->__pos, yythunkpos12= yy->__thunkpos;
+  {  int yypos13= yy->__pos, yythunkpos13= yy->__thunkpos;  if (!yymatchString(yy, "#<=<#")) goto l13;  goto l12;
+  l13:;	  YY_HEAT(yy, yypos13);  yy->__pos= yypos13; yy->__thunkpos= yythunkpos13;
+  }  if (!yymatchDot(yy)) goto l12;  goto l11;
+  l12:;	  YY_HEAT(yy, yypos12);  yy->__pos= yypos12; yy->__thunkpos= yythunkpos12;
+  }  if (!yymatchString(yy, "#<=<#")) goto l10;  YY_ALT_HIT(2);  goto l2;
+  l10:;	  YY_ALT_MISS(2, yypos2);  YY_HEAT(yy, yypos2);  yy->__pos= yypos2; yy->__thunkpos= yythunkpos2;
+  YY_ALT_TRY(3);
+  l15:;	
+  {  int yypos16= yy->__pos, yythunkpos16= yy->__thunkpos;
+  {  int yypos17= yy->__pos, yythunkpos17= yy->__thunkpos;  if (!yy_end_of_line(yy)) goto l17;  goto l16;
+  l17:;	  YY_HEAT(yy, yypos17);  yy->__pos= yypos17; yy->__thunkpos= yythunkpos17;
+  }  if (!yymatchDot(yy)) goto l16;  goto l15;
+  l16:;	  YY_HEAT(yy, yypos16);  yy->__pos= yypos16; yy->__thunkpos= yythunkpos16;
+  }  if (!yy_end_of_line(yy)) goto l14;  YY_ALT_HIT(3);  goto l2;
+  l14:;	  YY_ALT_MISS(3, yypos2);  goto l1;
   }
   l2:;	
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[42];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "comment", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_EPILOGUE(yy, 42, yypos0, 1);
   return 1;
-  l1:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[42];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "comment", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l1:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 42, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_space(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "space"));
-  {  int yypos17= yy->__pos, yythunkpos17= yy->__thunkpos;  if (!yymatchChar(yy, ' ')) goto l18;  goto l17;
-  l18:;	  yy->__pos= yypos17; yy->__thunkpos= yythunkpos17;  if (!yymatchChar(yy, '\t')) goto l19;  goto l17;
-  l19:;	  yy->__pos= yypos17; yy->__thunkpos= yythunkpos17;  if (!yy_end_of_line(yy)) goto l16;
-  }
-  l17:;	
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[41];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "space", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 41);
+  {  int yypos19= yy->__pos, yythunkpos19= yy->__thunkpos;
+  YY_ALT_TRY(6);  if (!yymatchChar(yy, ' ')) goto l20;  YY_ALT_HIT(6);  goto l19;
+  l20:;	  YY_ALT_MISS(6, yypos19);  YY_HEAT(yy, yypos19);  yy->__pos= yypos19; yy->__thunkpos= yythunkpos19;
+  YY_ALT_TRY(7);  if (!yymatchChar(yy, '\t')) goto l21;  YY_ALT_HIT(7);  goto l19;
+  l21:;	  YY_ALT_MISS(7, yypos19);  YY_HEAT(yy, yypos19);  yy->__pos= yypos19; yy->__thunkpos= yythunkpos19;
+  YY_ALT_TRY(8);  if (!yy_end_of_line(yy)) goto l22;  YY_ALT_HIT(8);  goto l19;
+  l22:;	  YY_ALT_MISS(8, yypos19);  goto l18;
+  }
+  l19:;	
+  YY_RULE_EPILOGUE(yy, 41, yypos0, 1);
   return 1;
-  l16:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[41];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "space", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l18:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 41, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_literalBraces(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "literalBraces"));
-  {  int yypos21= yy->__pos, yythunkpos21= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l22;
-  l23:;	
+  YY_RULE_PROLOGUE(yy, 40);
   {  int yypos24= yy->__pos, yythunkpos24= yy->__thunkpos;
-  {  int yypos25= yy->__pos, yythunkpos25= yy->__thunkpos;
-  {  int yypos26= yy->__pos, yythunkpos26= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l27;  goto l26;
-  l27:;	  yy->__pos= yypos26; yy->__thunkpos= yythunkpos26;  if (!yy_end_of_line(yy)) goto l25;
-  }
-  l26:;	  goto l24;
-  l25:;	  yy->__pos= yypos25; yy->__thunkpos= yythunkpos25;
-  }  if (!yy_char(yy)) goto l24;  goto l23;
-  l24:;	  yy->__pos= yypos24; yy->__thunkpos= yythunkpos24;
-  }  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l22;  goto l21;
-  l22:;	  yy->__pos= yypos21; yy->__thunkpos= yythunkpos21;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l20;
-  l28:;	
+  YY_ALT_TRY(9);  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l25;
+  l26:;	
+  {  int yypos27= yy->__pos, yythunkpos27= yy->__thunkpos;
+  {  int yypos28= yy->__pos, yythunkpos28= yy->__thunkpos;
   {  int yypos29= yy->__pos, yythunkpos29= yy->__thunkpos;
-  {  int yypos30= yy->__pos, yythunkpos30= yy->__thunkpos;
-  {  int yypos31= yy->__pos, yythunkpos31= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l32;  goto l31;
-  l32:;	  yy->__pos= yypos31; yy->__thunkpos= yythunkpos31;  if (!yy_end_of_line(yy)) goto l30;
-  }
-  l31:;	  goto l29;
-  l30:;	  yy->__pos= yypos30; yy->__thunkpos= yythunkpos30;
-  }  if (!yy_char(yy)) goto l29;  goto l28;
-  l29:;	  yy->__pos= yypos29; yy->__thunkpos= yythunkpos29;
-  }  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l20;
-  }
-  l21:;	
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[40];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "literalBraces", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_ALT_TRY(11);  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l30;  YY_ALT_HIT(11);  goto l29;
+  l30:;	  YY_ALT_MISS(11, yypos29);  YY_HEAT(yy, yypos29);  yy->__pos= yypos29; yy->__thunkpos= yythunkpos29;
+  YY_ALT_TRY(12);  if (!yy_end_of_line(yy)) goto l31;  YY_ALT_HIT(12);  goto l29;
+  l31:;	  YY_ALT_MISS(12, yypos29);  goto l28;
+  }
+  l29:;	  goto l27;
+  l28:;	  YY_HEAT(yy, yypos28);  yy->__pos= yypos28; yy->__thunkpos= yythunkpos28;
+  }  if (!yy_char(yy)) goto l27;  goto l26;
+  l27:;	  YY_HEAT(yy, yypos27);  yy->__pos= yypos27; yy->__thunkpos= yythunkpos27;
+  }  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l25;  YY_ALT_HIT(9);  goto l24;
+  l25:;	  YY_ALT_MISS(9, yypos24);  YY_HEAT(yy, yypos24);  yy->__pos= yypos24; yy->__thunkpos= yythunkpos24;
+  YY_ALT_TRY(10);  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l32;
+  l33:;	
+  {  int yypos34= yy->__pos, yythunkpos34= yy->__thunkpos;
+  {  int yypos35= yy->__pos, yythunkpos35= yy->__thunkpos;
+  {  int yypos36= yy->__pos, yythunkpos36= yy->__thunkpos;
+  YY_ALT_TRY(13);  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l37;  YY_ALT_HIT(13);  goto l36;
+  l37:;	  YY_ALT_MISS(13, yypos36);  YY_HEAT(yy, yypos36);  yy->__pos= yypos36; yy->__thunkpos= yythunkpos36;
+  YY_ALT_TRY(14);  if (!yy_end_of_line(yy)) goto l38;  YY_ALT_HIT(14);  goto l36;
+  l38:;	  YY_ALT_MISS(14, yypos36);  goto l35;
+  }
+  l36:;	  goto l34;
+  l35:;	  YY_HEAT(yy, yypos35);  yy->__pos= yypos35; yy->__thunkpos= yythunkpos35;
+  }  if (!yy_char(yy)) goto l34;  goto l33;
+  l34:;	  YY_HEAT(yy, yypos34);  yy->__pos= yypos34; yy->__thunkpos= yythunkpos34;
+  }  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l32;  YY_ALT_HIT(10);  goto l24;
+  l32:;	  YY_ALT_MISS(10, yypos24);  goto l23;
+  }
+  l24:;	
+  YY_RULE_EPILOGUE(yy, 40, yypos0, 1);
   return 1;
-  l20:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[40];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "literalBraces", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l23:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 40, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_braces(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "braces"));
-  {  int yypos34= yy->__pos, yythunkpos34= yy->__thunkpos;  if (!yymatchChar(yy, '{')) goto l35;
-  l36:;	
-  {  int yypos37= yy->__pos, yythunkpos37= yy->__thunkpos;  if (!yy_braces(yy)) goto l37;  goto l36;
-  l37:;	  yy->__pos= yypos37; yy->__thunkpos= yythunkpos37;
-  }  if (!yymatchChar(yy, '}')) goto l35;  goto l34;
-  l35:;	  yy->__pos= yypos34; yy->__thunkpos= yythunkpos34;  if (!yy_literalBraces(yy)) goto l38;  goto l34;
-  l38:;	  yy->__pos= yypos34; yy->__thunkpos= yythunkpos34;
-  {  int yypos39= yy->__pos, yythunkpos39= yy->__thunkpos;  if (!yymatchChar(yy, '}')) goto l39;  goto l33;
-  l39:;	  yy->__pos= yypos39; yy->__thunkpos= yythunkpos39;
-  }
-  {  int yypos40= yy->__pos, yythunkpos40= yy->__thunkpos;  if (!yy_end_of_line(yy)) goto l41;  goto l40;
-  l41:;	  yy->__pos= yypos40; yy->__thunkpos= yythunkpos40;  if (!yymatchDot(yy)) goto l33;
+  YY_RULE_PROLOGUE(yy, 39);
+  {  int yypos40= yy->__pos, yythunkpos40= yy->__thunkpos;
+  YY_ALT_TRY(15);  if (!yymatchChar(yy, '{')) goto l41;
+  l42:;	
+  {  int yypos43= yy->__pos, yythunkpos43= yy->__thunkpos;  if (!yy_braces(yy)) goto l43;  goto l42;
+  l43:;	  YY_HEAT(yy, yypos43);  yy->__pos= yypos43; yy->__thunkpos= yythunkpos43;
+  }  if (!yymatchChar(yy, '}')) goto l41;  YY_ALT_HIT(15);  goto l40;
+  l41:;	  YY_ALT_MISS(15, yypos40);  YY_HEAT(yy, yypos40);  yy->__pos= yypos40; yy->__thunkpos= yythunkpos40;
+  YY_ALT_TRY(16);  if (!yy_literalBraces(yy)) goto l44;  YY_ALT_HIT(16);  goto l40;
+  l44:;	  YY_ALT_MISS(16, yypos40);  YY_HEAT(yy, yypos40);  yy->__pos= yypos40; yy->__thunkpos= yythunkpos40;
+  YY_ALT_TRY(17);
+  {  int yypos46= yy->__pos, yythunkpos46= yy->__thunkpos;  if (!yymatchChar(yy, '}')) goto l46;  goto l45;
+  l46:;	  YY_HEAT(yy, yypos46);  yy->__pos= yypos46; yy->__thunkpos= yythunkpos46;
+  }
+  {  int yypos47= yy->__pos, yythunkpos47= yy->__thunkpos;
+  YY_ALT_TRY(18);  if (!yy_end_of_line(yy)) goto l48;  YY_ALT_HIT(18);  goto l47;
+  l48:;	  YY_ALT_MISS(18, yypos47);  YY_HEAT(yy, yypos47);  yy->__pos= yypos47; yy->__thunkpos= yythunkpos47;
+  YY_ALT_TRY(19);  if (!yymatchDot(yy)) goto l49;  YY_ALT_HIT(19);  goto l47;
+  l49:;	  YY_ALT_MISS(19, yypos47);  goto l45;
+  }
+  l47:;	  YY_ALT_HIT(17);  goto l40;
+  l45:;	  YY_ALT_MISS(17, yypos40);  goto l39;
   }
   l40:;	
-  }
-  l34:;	
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[39];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "braces", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_EPILOGUE(yy, 39, yypos0, 1);
   return 1;
-  l33:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[39];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "braces", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l39:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 39, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_range(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "range"));
-  {  int yypos43= yy->__pos, yythunkpos43= yy->__thunkpos;  if (!yy_char(yy)) goto l44;  if (!yymatchChar(yy, '-')) goto l44;
-  {  int yypos45= yy->__pos, yythunkpos45= yy->__thunkpos;  if (!yymatchChar(yy, ']')) goto l45;  goto l44;
-  l45:;	  yy->__pos= yypos45; yy->__thunkpos= yythunkpos45;
-  }  if (!yy_char(yy)) goto l44;  goto l43;
-  l44:;	  yy->__pos= yypos43; yy->__thunkpos= yythunkpos43;  if (!yy_char(yy)) goto l42;
-  }
-  l43:;	
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[38];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "range", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 38);
+  {  int yypos51= yy->__pos, yythunkpos51= yy->__thunkpos;
+  YY_ALT_TRY(20);  if (!yy_char(yy)) goto l52;  if (!yymatchChar(yy, '-')) goto l52;
+  {  int yypos53= yy->__pos, yythunkpos53= yy->__thunkpos;  if (!yymatchChar(yy, ']')) goto l53;  goto l52;
+  l53:;	  YY_HEAT(yy, yypos53);  yy->__pos= yypos53; yy->__thunkpos= yythunkpos53;
+  }  if (!yy_char(yy)) goto l52;  YY_ALT_HIT(20);  goto l51;
+  l52:;	  YY_ALT_MISS(20, yypos51);  YY_HEAT(yy, yypos51);  yy->__pos= yypos51; yy->__thunkpos= yythunkpos51;
+  YY_ALT_TRY(21);  if (!yy_char(yy)) goto l54;  YY_ALT_HIT(21);  goto l51;
+  l54:;	  YY_ALT_MISS(21, yypos51);  goto l50;
+  }
+  l51:;	
+  YY_RULE_EPILOGUE(yy, 38, yypos0, 1);
   return 1;
-  l42:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[38];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "range", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l50:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 38, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_char(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "char"));
-  {  int yypos47= yy->__pos, yythunkpos47= yy->__thunkpos;  if (!yymatchChar(yy, '\\')) goto l48;
-  {  int yypos49= yy->__pos, yythunkpos49= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l50;  goto l49;
-  l50:;	  yy->__pos= yypos49; yy->__thunkpos= yythunkpos49;  if (!yymatchChar(yy, 'x')) goto l51;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l51;
-  {  int yypos52= yy->__pos, yythunkpos52= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l52;  goto l53;
-  l52:;	  yy->__pos= yypos52; yy->__thunkpos= yythunkpos52;
-  }
-  l53:;	  goto l49;
-  l51:;	  yy->__pos= yypos49; yy->__thunkpos= yythunkpos49;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l54;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l54;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l54;  goto l49;
-  l54:;	  yy->__pos= yypos49; yy->__thunkpos= yythunkpos49;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l48;
-  {  int yypos55= yy->__pos, yythunkpos55= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l55;  goto l56;
-  l55:;	  yy->__pos= yypos55; yy->__thunkpos= yythunkpos55;
+  YY_RULE_PROLOGUE(yy, 37);
+  {  int yypos56= yy->__pos, yythunkpos56= yy->__thunkpos;
+  YY_ALT_TRY(22);  if (!yymatchChar(yy, '\\')) goto l57;
+  {  int yypos58= yy->__pos, yythunkpos58= yy->__thunkpos;
+  YY_ALT_TRY(24);  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l59;  YY_ALT_HIT(24);  goto l58;
+  l59:;	  YY_ALT_MISS(24, yypos58);  YY_HEAT(yy, yypos58);  yy->__pos= yypos58; yy->__thunkpos= yythunkpos58;
+  YY_ALT_TRY(25);  if (!yymatchChar(yy, 'x')) goto l60;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l60;
+  {  int yypos61= yy->__pos, yythunkpos61= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l61;  goto l62;
+  l61:;	  YY_HEAT(yy, yypos61);  yy->__pos= yypos61; yy->__thunkpos= yythunkpos61;
+  }
+  l62:;	  YY_ALT_HIT(25);  goto l58;
+  l60:;	  YY_ALT_MISS(25, yypos58);  YY_HEAT(yy, yypos58);  yy->__pos= yypos58; yy->__thunkpos= yythunkpos58;
+  YY_ALT_TRY(26);  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l63;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l63;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l63;  YY_ALT_HIT(26);  goto l58;
+  l63:;	  YY_ALT_MISS(26, yypos58);  YY_HEAT(yy, yypos58);  yy->__pos= yypos58; yy->__thunkpos= yythunkpos58;
+  YY_ALT_TRY(27);  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l64;
+  {  int yypos65= yy->__pos, yythunkpos65= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l65;  goto l66;
+  l65:;	  YY_HEAT(yy, yypos65);  yy->__pos= yypos65; yy->__thunkpos= yythunkpos65;
+  }
+  l66:;	  YY_ALT_HIT(27);  goto l58;
+  l64:;	  YY_ALT_MISS(27, yypos58);  goto l57;
+  }
+  l58:;	  YY_ALT_HIT(22);  goto l56;
+  l57:;	  YY_ALT_MISS(22, yypos56);  YY_HEAT(yy, yypos56);  yy->__pos= yypos56; yy->__thunkpos= yythunkpos56;
+  YY_ALT_TRY(23);
+  {  int yypos68= yy->__pos, yythunkpos68= yy->__thunkpos;  if (!yymatchChar(yy, '\\')) goto l68;  goto l67;
+  l68:;	  YY_HEAT(yy, yypos68);  yy->__pos= yypos68; yy->__thunkpos= yythunkpos68;
+  }  if (!yymatchDot(yy)) goto l67;  YY_ALT_HIT(23);  goto l56;
+  l67:;	  YY_ALT_MISS(23, yypos56);  goto l55;
   }
   l56:;	
-  }
-  l49:;	  goto l47;
-  l48:;	  yy->__pos= yypos47; yy->__thunkpos= yythunkpos47;
-  {  int yypos57= yy->__pos, yythunkpos57= yy->__thunkpos;  if (!yymatchChar(yy, '\\')) goto l57;  goto l46;
-  l57:;	  yy->__pos= yypos57; yy->__thunkpos= yythunkpos57;
-  }  if (!yymatchDot(yy)) goto l46;
-  }
-  l47:;	
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[37];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "char", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_EPILOGUE(yy, 37, yypos0, 1);
   return 1;
-  l46:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[37];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "char", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l55:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 37, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_END(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "END"));  if (!yymatchChar(yy, '>')) goto l58;  if (!yy__(yy)) goto l58;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[36];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "END", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 36);  if (!yymatchChar(yy, '>')) goto l69;  if (!yy__(yy)) goto l69;
+  YY_RULE_EPILOGUE(yy, 36, yypos0, 1);
   return 1;
-  l58:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[36];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "END", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l69:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 36, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_BEGIN(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "BEGIN"));  if (!yymatchChar(yy, '<')) goto l59;  if (!yy__(yy)) goto l59;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[35];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "BEGIN", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 35);  if (!yymatchChar(yy, '<')) goto l70;  if (!yy__(yy)) goto l70;
+  YY_RULE_EPILOGUE(yy, 35, yypos0, 1);
   return 1;
-  l59:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[35];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "BEGIN", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l70:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 35, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_DOT(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "DOT"));  if (!yymatchChar(yy, '.')) goto l60;  if (!yy__(yy)) goto l60;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[34];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "DOT", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 34);  if (!yymatchChar(yy, '.')) goto l71;  if (!yy__(yy)) goto l71;
+  YY_RULE_EPILOGUE(yy, 34, yypos0, 1);
   return 1;
-  l60:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[34];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "DOT", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l71:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 34, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_class(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "class"));  if (!yymatchChar(yy, '[')) goto l61;  yyText(yy, yy->__begin, yy->__end);  {
+  YY_RULE_PROLOGUE(yy, 33);  if (!yymatchChar(yy, '[')) goto l72;  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
-if (!(YY_BEGIN)) goto l61;
+if (!(YY_BEGIN)) goto l72;
 #undef yytext
 #undef yyleng
   }
-  l62:;	
-  {  int yypos63= yy->__pos, yythunkpos63= yy->__thunkpos;
-  {  int yypos64= yy->__pos, yythunkpos64= yy->__thunkpos;  if (!yymatchChar(yy, ']')) goto l64;  goto l63;
-  l64:;	  yy->__pos= yypos64; yy->__thunkpos= yythunkpos64;
-  }  if (!yy_range(yy)) goto l63;  goto l62;
-  l63:;	  yy->__pos= yypos63; yy->__thunkpos= yythunkpos63;
+  l73:;	
+  {  int yypos74= yy->__pos, yythunkpos74= yy->__thunkpos;
+  {  int yypos75= yy->__pos, yythunkpos75= yy->__thunkpos;  if (!yymatchChar(yy, ']')) goto l75;  goto l74;
+  l75:;	  YY_HEAT(yy, yypos75);  yy->__pos= yypos75; yy->__thunkpos= yythunkpos75;
+  }  if (!yy_range(yy)) goto l74;  goto l73;
+  l74:;	  YY_HEAT(yy, yypos74);  yy->__pos= yypos74; yy->__thunkpos= yythunkpos74;
   }  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
-if (!(YY_END)) goto l61;
+if (!(YY_END)) goto l72;
 #undef yytext
 #undef yyleng
-  }  if (!yymatchChar(yy, ']')) goto l61;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[33];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "class", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  }  if (!yymatchChar(yy, ']')) goto l72;
+  YY_RULE_EPILOGUE(yy, 33, yypos0, 1);
   return 1;
-  l61:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[33];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "class", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l72:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 33, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_identstart(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "identstart"));  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l65;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[32];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "identstart", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 32);  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l76;
+  YY_RULE_EPILOGUE(yy, 32, yypos0, 1);
   return 1;
-  l65:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[32];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "identstart", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l76:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 32, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_literalDQ(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "literalDQ"));  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l66;  yyText(yy, yy->__begin, yy->__end);  {
+  YY_RULE_PROLOGUE(yy, 31);  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l77;  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
-if (!(YY_BEGIN)) goto l66;
+if (!(YY_BEGIN)) goto l77;
 #undef yytext
 #undef yyleng
   }
-  l67:;	
-  {  int yypos68= yy->__pos, yythunkpos68= yy->__thunkpos;
-  {  int yypos69= yy->__pos, yythunkpos69= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\044\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l69;  goto l68;
-  l69:;	  yy->__pos= yypos69; yy->__thunkpos= yythunkpos69;
-  }  if (!yy_char(yy)) goto l68;  goto l67;
-  l68:;	  yy->__pos= yypos68; yy->__thunkpos= yythunkpos68;
+  l78:;	
+  {  int yypos79= yy->__pos, yythunkpos79= yy->__thunkpos;
+  {  int yypos80= yy->__pos, yythunkpos80= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\044\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l80;  goto l79;
+  l80:;	  YY_HEAT(yy, yypos80);  yy->__pos= yypos80; yy->__thunkpos= yythunkpos80;
+  }  if (!yy_char(yy)) goto l79;  goto l78;
+  l79:;	  YY_HEAT(yy, yypos79);  yy->__pos= yypos79; yy->__thunkpos= yythunkpos79;
   }  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
-if (!(YY_END)) goto l66;
+if (!(YY_END)) goto l77;
 #undef yytext
 #undef yyleng
-  }  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l66;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[31];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "literalDQ", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  }  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l77;
+  YY_RULE_EPILOGUE(yy, 31, yypos0, 1);
   return 1;
-  l66:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[31];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "literalDQ", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l77:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 31, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_literalSQ(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "literalSQ"));  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l70;  yyText(yy, yy->__begin, yy->__end);  {
+  YY_RULE_PROLOGUE(yy, 30);  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l81;  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
-if (!(YY_BEGIN)) goto l70;
+if (!(YY_BEGIN)) goto l81;
 #undef yytext
 #undef yyleng
   }
-  l71:;	
-  {  int yypos72= yy->__pos, yythunkpos72= yy->__thunkpos;
-  {  int yypos73= yy->__pos, yythunkpos73= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\044\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l73;  goto l72;
-  l73:;	  yy->__pos= yypos73; yy->__thunkpos= yythunkpos73;
-  }  if (!yy_char(yy)) goto l72;  goto l71;
-  l72:;	  yy->__pos= yypos72; yy->__thunkpos= yythunkpos72;
+  l82:;	
+  {  int yypos83= yy->__pos, yythunkpos83= yy->__thunkpos;
+  {  int yypos84= yy->__pos, yythunkpos84= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\044\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l84;  goto l83;
+  l84:;	  YY_HEAT(yy, yypos84);  yy->__pos= yypos84; yy->__thunkpos= yythunkpos84;
+  }  if (!yy_char(yy)) goto l83;  goto l82;
+  l83:;	  YY_HEAT(yy, yypos83);  yy->__pos= yypos83; yy->__thunkpos= yythunkpos83;
   }  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
-if (!(YY_END)) goto l70;
+if (!(YY_END)) goto l81;
 #undef yytext
 #undef yyleng
-  }  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l70;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[30];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "literalSQ", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  }  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l81;
+  YY_RULE_EPILOGUE(yy, 30, yypos0, 1);
   return 1;
-  l70:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[30];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "literalSQ", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l81:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 30, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_CLOSE(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "CLOSE"));  if (!yymatchChar(yy, ')')) goto l74;  if (!yy__(yy)) goto l74;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[29];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "CLOSE", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 29);  if (!yymatchChar(yy, ')')) goto l85;  if (!yy__(yy)) goto l85;
+  YY_RULE_EPILOGUE(yy, 29, yypos0, 1);
   return 1;
-  l74:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[29];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "CLOSE", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l85:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 29, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_OPEN(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "OPEN"));  if (!yymatchChar(yy, '(')) goto l75;  if (!yy__(yy)) goto l75;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[28];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "OPEN", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 28);  if (!yymatchChar(yy, '(')) goto l86;  if (!yy__(yy)) goto l86;
+  YY_RULE_EPILOGUE(yy, 28, yypos0, 1);
   return 1;
-  l75:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[28];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "OPEN", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l86:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 28, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_COLON(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "COLON"));  if (!yymatchChar(yy, ':')) goto l76;  if (!yy__(yy)) goto l76;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[27];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "COLON", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 27);  if (!yymatchChar(yy, ':')) goto l87;  if (!yy__(yy)) goto l87;
+  YY_RULE_EPILOGUE(yy, 27, yypos0, 1);
   return 1;
-  l76:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[27];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "COLON", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l87:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 27, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_PLUS(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "PLUS"));  if (!yymatchChar(yy, '+')) goto l77;  if (!yy__(yy)) goto l77;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[26];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "PLUS", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 26);  if (!yymatchChar(yy, '+')) goto l88;  if (!yy__(yy)) goto l88;
+  YY_RULE_EPILOGUE(yy, 26, yypos0, 1);
   return 1;
-  l77:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[26];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "PLUS", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l88:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 26, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_STAR(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "STAR"));  if (!yymatchChar(yy, '*')) goto l78;  if (!yy__(yy)) goto l78;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[25];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "STAR", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 25);  if (!yymatchChar(yy, '*')) goto l89;  if (!yy__(yy)) goto l89;
+  YY_RULE_EPILOGUE(yy, 25, yypos0, 1);
   return 1;
-  l78:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[25];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "STAR", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l89:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 25, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_QUESTION(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "QUESTION"));  if (!yymatchChar(yy, '?')) goto l79;  if (!yy__(yy)) goto l79;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[24];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "QUESTION", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 24);  if (!yymatchChar(yy, '?')) goto l90;  if (!yy__(yy)) goto l90;
+  YY_RULE_EPILOGUE(yy, 24, yypos0, 1);
   return 1;
-  l79:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[24];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "QUESTION", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l90:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 24, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_primary(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "primary"));
-  {  int yypos81= yy->__pos, yythunkpos81= yy->__thunkpos;  if (!yy_identifier(yy)) goto l82;
-  {  int yypos83= yy->__pos, yythunkpos83= yy->__thunkpos;  if (!yy_COLON(yy)) goto l84;  yyDo(yy, yy_1_primary, yy->__begin, yy->__end);  if (!yy_identifier(yy)) goto l84;
-  {  int yypos85= yy->__pos, yythunkpos85= yy->__thunkpos;  if (!yy_EQUAL(yy)) goto l85;  goto l84;
-  l85:;	  yy->__pos= yypos85; yy->__thunkpos= yythunkpos85;
-  }  yyDo(yy, yy_2_primary, yy->__begin, yy->__end);  goto l83;
-  l84:;	  yy->__pos= yypos83; yy->__thunkpos= yythunkpos83;
-  {  int yypos86= yy->__pos, yythunkpos86= yy->__thunkpos;  if (!yy_EQUAL(yy)) goto l86;  goto l82;
-  l86:;	  yy->__pos= yypos86; yy->__thunkpos= yythunkpos86;
-  }  yyDo(yy, yy_3_primary, yy->__begin, yy->__end);
-  }
-  l83:;	  goto l81;
-  l82:;	  yy->__pos= yypos81; yy->__thunkpos= yythunkpos81;  if (!yy_OPEN(yy)) goto l87;  if (!yy_expression(yy)) goto l87;  if (!yy_CLOSE(yy)) goto l89;  goto l88;
-  l89:;	  yyText(yy, yy->__begin, yy->__end);  {
+  YY_RULE_PROLOGUE(yy, 23);
+  {  int yypos92= yy->__pos, yythunkpos92= yy->__thunkpos;
+  YY_ALT_TRY(28);  if (!yy_identifier(yy)) goto l93;
+  {  int yypos94= yy->__pos, yythunkpos94= yy->__thunkpos;
+  YY_ALT_TRY(36);  if (!yy_COLON(yy)) goto l95;  yyDo(yy, yy_1_primary, yy->__begin, yy->__end);  if (!yy_identifier(yy)) goto l95;
+  {  int yypos96= yy->__pos, yythunkpos96= yy->__thunkpos;  if (!yy_EQUAL(yy)) goto l96;  goto l95;
+  l96:;	  YY_HEAT(yy, yypos96);  yy->__pos= yypos96; yy->__thunkpos= yythunkpos96;
+  }  yyDo(yy, yy_2_primary, yy->__begin, yy->__end);  YY_ALT_HIT(36);  goto l94;
+  l95:;	  YY_ALT_MISS(36, yypos94);  YY_HEAT(yy, yypos94);  yy->__pos= yypos94; yy->__thunkpos= yythunkpos94;
+  YY_ALT_TRY(37);
+  {  int yypos98= yy->__pos, yythunkpos98= yy->__thunkpos;  if (!yy_EQUAL(yy)) goto l98;  goto l97;
+  l98:;	  YY_HEAT(yy, yypos98);  yy->__pos= yypos98; yy->__thunkpos= yythunkpos98;
+  }  yyDo(yy, yy_3_primary, yy->__begin, yy->__end);  YY_ALT_HIT(37);  goto l94;
+  l97:;	  YY_ALT_MISS(37, yypos94);  goto l93;
+  }
+  l94:;	  YY_ALT_HIT(28);  goto l92;
+  l93:;	  YY_ALT_MISS(28, yypos92);  YY_HEAT(yy, yypos92);  yy->__pos= yypos92; yy->__thunkpos= yythunkpos92;
+  YY_ALT_TRY(29);  if (!yy_OPEN(yy)) goto l99;  if (!yy_expression(yy)) goto l99;  if (!yy_CLOSE(yy)) goto l101;  goto l100;
+  l101:;	  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
   yyerror("missing expected `)`");;
 #undef yytext
 #undef yyleng
-  }  goto l87;
-  l88:;	  goto l81;
-  l87:;	  yy->__pos= yypos81; yy->__thunkpos= yythunkpos81;
-  {  int yypos91= yy->__pos, yythunkpos91= yy->__thunkpos;  if (!yy_literalSQ(yy)) goto l92;  yyDo(yy, yy_4_primary, yy->__begin, yy->__end);  goto l91;
-  l92:;	  yy->__pos= yypos91; yy->__thunkpos= yythunkpos91;  if (!yy_literalDQ(yy)) goto l90;  yyDo(yy, yy_5_primary, yy->__begin, yy->__end);
-  }
-  l91:;	
-  {  int yypos93= yy->__pos, yythunkpos93= yy->__thunkpos;  if (!yymatchChar(yy, 'i')) goto l93;
-  {  int yypos95= yy->__pos, yythunkpos95= yy->__thunkpos;  if (!yy_identstart(yy)) goto l95;  goto l93;
-  l95:;	  yy->__pos= yypos95; yy->__thunkpos= yythunkpos95;
-  }  yyDo(yy, yy_6_primary, yy->__begin, yy->__end);  goto l94;
-  l93:;	  yy->__pos= yypos93; yy->__thunkpos= yythunkpos93;
-  }
-  l94:;	  if (!yy__(yy)) goto l90;  goto l81;
-  l90:;	  yy->__pos= yypos81; yy->__thunkpos= yythunkpos81;  if (!yy_class(yy)) goto l96;  yyDo(yy, yy_7_primary, yy->__begin, yy->__end);
-  {  int yypos97= yy->__pos, yythunkpos97= yy->__thunkpos;  if (!yymatchChar(yy, 'i')) goto l97;
-  {  int yypos99= yy->__pos, yythunkpos99= yy->__thunkpos;  if (!yy_identstart(yy)) goto l99;  goto l97;
-  l99:;	  yy->__pos= yypos99; yy->__thunkpos= yythunkpos99;
-  }  yyDo(yy, yy_8_primary, yy->__begin, yy->__end);  goto l98;
-  l97:;	  yy->__pos= yypos97; yy->__thunkpos= yythunkpos97;
-  }
-  l98:;	  if (!yy__(yy)) goto l96;  goto l81;
-  l96:;	  yy->__pos= yypos81; yy->__thunkpos= yythunkpos81;  if (!yy_DOT(yy)) goto l100;  yyDo(yy, yy_9_primary, yy->__begin, yy->__end);  goto l81;
-  l100:;	  yy->__pos= yypos81; yy->__thunkpos= yythunkpos81;  if (!yy_action(yy)) goto l101;  yyDo(yy, yy_10_primary, yy->__begin, yy->__end);  goto l81;
-  l101:;	  yy->__pos= yypos81; yy->__thunkpos= yythunkpos81;  if (!yy_BEGIN(yy)) goto l102;  yyDo(yy, yy_11_primary, yy->__begin, yy->__end);  goto l81;
-  l102:;	  yy->__pos= yypos81; yy->__thunkpos= yythunkpos81;  if (!yy_END(yy)) goto l80;  yyDo(yy, yy_12_primary, yy->__begin, yy->__end);
-  }
-  l81:;	
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[23];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "primary", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  }  goto l99;
+  l100:;	  YY_ALT_HIT(29);  goto l92;
+  l99:;	  YY_ALT_MISS(29, yypos92);  YY_HEAT(yy, yypos92);  yy->__pos= yypos92; yy->__thunkpos= yythunkpos92;
+  YY_ALT_TRY(30);
+  {  int yypos103= yy->__pos, yythunkpos103= yy->__thunkpos;
+  YY_ALT_TRY(38);  if (!yy_literalSQ(yy)) goto l104;  yyDo(yy, yy_4_primary, yy->__begin, yy->__end);  YY_ALT_HIT(38);  goto l103;
+  l104:;	  YY_ALT_MISS(38, yypos103);  YY_HEAT(yy, yypos103);  yy->__pos= yypos103; yy->__thunkpos= yythunkpos103;
+  YY_ALT_TRY(39);  if (!yy_literalDQ(yy)) goto l105;  yyDo(yy, yy_5_primary, yy->__begin, yy->__end);  YY_ALT_HIT(39);  goto l103;
+  l105:;	  YY_ALT_MISS(39, yypos103);  goto l102;
+  }
+  l103:;	
+  {  int yypos106= yy->__pos, yythunkpos106= yy->__thunkpos;  if (!yymatchChar(yy, 'i')) goto l106;
+  {  int yypos108= yy->__pos, yythunkpos108= yy->__thunkpos;  if (!yy_identstart(yy)) goto l108;  goto l106;
+  l108:;	  YY_HEAT(yy, yypos108);  yy->__pos= yypos108; yy->__thunkpos= yythunkpos108;
+  }  yyDo(yy, yy_6_primary, yy->__begin, yy->__end);  goto l107;
+  l106:;	  YY_HEAT(yy, yypos106);  yy->__pos= yypos106; yy->__thunkpos= yythunkpos106;
+  }
+  l107:;	  if (!yy__(yy)) goto l102;  YY_ALT_HIT(30);  goto l92;
+  l102:;	  YY_ALT_MISS(30, yypos92);  YY_HEAT(yy, yypos92);  yy->__pos= yypos92; yy->__thunkpos= yythunkpos92;
+  YY_ALT_TRY(31);  if (!yy_class(yy)) goto l109;  yyDo(yy, yy_7_primary, yy->__begin, yy->__end);
+  {  int yypos110= yy->__pos, yythunkpos110= yy->__thunkpos;  if (!yymatchChar(yy, 'i')) goto l110;
+  {  int yypos112= yy->__pos, yythunkpos112= yy->__thunkpos;  if (!yy_identstart(yy)) goto l112;  goto l110;
+  l112:;	  YY_HEAT(yy, yypos112);  yy->__pos= yypos112; yy->__thunkpos= yythunkpos112;
+  }  yyDo(yy, yy_8_primary, yy->__begin, yy->__end);  goto l111;
+  l110:;	  YY_HEAT(yy, yypos110);  yy->__pos= yypos110; yy->__thunkpos= yythunkpos110;
+  }
+  l111:;	  if (!yy__(yy)) goto l109;  YY_ALT_HIT(31);  goto l92;
+  l109:;	  YY_ALT_MISS(31, yypos92);  YY_HEAT(yy, yypos92);  yy->__pos= yypos92; yy->__thunkpos= yythunkpos92;
+  YY_ALT_TRY(32);  if (!yy_DOT(yy)) goto l113;  yyDo(yy, yy_9_primary, yy->__begin, yy->__end);  YY_ALT_HIT(32);  goto l92;
+  l113:;	  YY_ALT_MISS(32, yypos92);  YY_HEAT(yy, yypos92);  yy->__pos= yypos92; yy->__thunkpos= yythunkpos92;
+  YY_ALT_TRY(33);  if (!yy_action(yy)) goto l114;  yyDo(yy, yy_10_primary, yy->__begin, yy->__end);  YY_ALT_HIT(33);  goto l92;
+  l114:;	  YY_ALT_MISS(33, yypos92);  YY_HEAT(yy, yypos92);  yy->__pos= yypos92; yy->__thunkpos= yythunkpos92;
+  YY_ALT_TRY(34);  if (!yy_BEGIN(yy)) goto l115;  yyDo(yy, yy_11_primary, yy->__begin, yy->__end);  YY_ALT_HIT(34);  goto l92;
+  l115:;	  YY_ALT_MISS(34, yypos92);  YY_HEAT(yy, yypos92);  yy->__pos= yypos92; yy->__thunkpos= yythunkpos92;
+  YY_ALT_TRY(35);  if (!yy_END(yy)) goto l116;  yyDo(yy, yy_12_primary, yy->__begin, yy->__end);  YY_ALT_HIT(35);  goto l92;
+  l116:;	  YY_ALT_MISS(35, yypos92);  goto l91;
+  }
+  l92:;	
+  YY_RULE_EPILOGUE(yy, 23, yypos0, 1);
   return 1;
-  l80:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[23];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "primary", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l91:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 23, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_NOT(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "NOT"));  if (!yymatchChar(yy, '!')) goto l103;  if (!yy__(yy)) goto l103;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[22];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "NOT", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 22);  if (!yymatchChar(yy, '!')) goto l117;  if (!yy__(yy)) goto l117;
+  YY_RULE_EPILOGUE(yy, 22, yypos0, 1);
   return 1;
-  l103:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[22];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "NOT", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l117:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 22, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_suffix(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "suffix"));  if (!yy_primary(yy)) goto l104;
-  {  int yypos105= yy->__pos, yythunkpos105= yy->__thunkpos;
-  {  int yypos107= yy->__pos, yythunkpos107= yy->__thunkpos;  if (!yy_QUESTION(yy)) goto l108;  yyDo(yy, yy_1_suffix, yy->__begin, yy->__end);  goto l107;
-  l108:;	  yy->__pos= yypos107; yy->__thunkpos= yythunkpos107;  if (!yy_STAR(yy)) goto l109;  yyDo(yy, yy_2_suffix, yy->__begin, yy->__end);  goto l107;
-  l109:;	  yy->__pos= yypos107; yy->__thunkpos= yythunkpos107;  if (!yy_PLUS(yy)) goto l105;  yyDo(yy, yy_3_suffix, yy->__begin, yy->__end);
-  }
-  l107:;	  goto l106;
-  l105:;	  yy->__pos= yypos105; yy->__thunkpos= yythunkpos105;
-  }
-  l106:;	
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[21];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "suffix", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 21);  if (!yy_primary(yy)) goto l118;
+  {  int yypos119= yy->__pos, yythunkpos119= yy->__thunkpos;
+  {  int yypos121= yy->__pos, yythunkpos121= yy->__thunkpos;
+  YY_ALT_TRY(40);  if (!yy_QUESTION(yy)) goto l122;  yyDo(yy, yy_1_suffix, yy->__begin, yy->__end);  YY_ALT_HIT(40);  goto l121;
+  l122:;	  YY_ALT_MISS(40, yypos121);  YY_HEAT(yy, yypos121);  yy->__pos= yypos121; yy->__thunkpos= yythunkpos121;
+  YY_ALT_TRY(41);  if (!yy_STAR(yy)) goto l123;  yyDo(yy, yy_2_suffix, yy->__begin, yy->__end);  YY_ALT_HIT(41);  goto l121;
+  l123:;	  YY_ALT_MISS(41, yypos121);  YY_HEAT(yy, yypos121);  yy->__pos= yypos121; yy->__thunkpos= yythunkpos121;
+  YY_ALT_TRY(42);  if (!yy_PLUS(yy)) goto l124;  yyDo(yy, yy_3_suffix, yy->__begin, yy->__end);  YY_ALT_HIT(42);  goto l121;
+  l124:;	  YY_ALT_MISS(42, yypos121);  goto l119;
+  }
+  l121:;	  goto l120;
+  l119:;	  YY_HEAT(yy, yypos119);  yy->__pos= yypos119; yy->__thunkpos= yythunkpos119;
+  }
+  l120:;	
+  YY_RULE_EPILOGUE(yy, 21, yypos0, 1);
   return 1;
-  l104:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[21];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "suffix", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l118:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 21, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_AND(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "AND"));  if (!yymatchChar(yy, '&')) goto l110;  if (!yy__(yy)) goto l110;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[20];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "AND", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 20);  if (!yymatchChar(yy, '&')) goto l125;  if (!yy__(yy)) goto l125;
+  YY_RULE_EPILOGUE(yy, 20, yypos0, 1);
   return 1;
-  l110:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[20];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "AND", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l125:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 20, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_AT(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "AT"));  if (!yymatchChar(yy, '@')) goto l111;  if (!yy__(yy)) goto l111;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[19];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "AT", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 19);  if (!yymatchChar(yy, '@')) goto l126;  if (!yy__(yy)) goto l126;
+  YY_RULE_EPILOGUE(yy, 19, yypos0, 1);
   return 1;
-  l111:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[19];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "AT", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l126:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 19, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_action(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "action"));  if (!yymatchChar(yy, '{')) goto l112;  yyDo(yy, yy_1_action, yy->__begin, yy->__end);  yyText(yy, yy->__begin, yy->__end);  {
+  YY_RULE_PROLOGUE(yy, 18);  if (!yymatchChar(yy, '{')) goto l127;  yyDo(yy, yy_1_action, yy->__begin, yy->__end);  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
-if (!(YY_BEGIN)) goto l112;
+if (!(YY_BEGIN)) goto l127;
 #undef yytext
 #undef yyleng
   }
-  l113:;	
-  {  int yypos114= yy->__pos, yythunkpos114= yy->__thunkpos;  if (!yy_braces(yy)) goto l114;  goto l113;
-  l114:;	  yy->__pos= yypos114; yy->__thunkpos= yythunkpos114;
+  l128:;	
+  {  int yypos129= yy->__pos, yythunkpos129= yy->__thunkpos;  if (!yy_braces(yy)) goto l129;  goto l128;
+  l129:;	  YY_HEAT(yy, yypos129);  yy->__pos= yypos129; yy->__thunkpos= yythunkpos129;
   }  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
-if (!(YY_END)) goto l112;
+if (!(YY_END)) goto l127;
 #undef yytext
 #undef yyleng
-  }  if (!yymatchChar(yy, '}')) goto l112;  if (!yy__(yy)) goto l112;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[18];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "action", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  }  if (!yymatchChar(yy, '}')) goto l127;  if (!yy__(yy)) goto l127;
+  YY_RULE_EPILOGUE(yy, 18, yypos0, 1);
   return 1;
-  l112:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[18];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "action", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l127:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 18, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_TILDE(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "TILDE"));  if (!yymatchChar(yy, '~')) goto l115;  if (!yy__(yy)) goto l115;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[17];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "TILDE", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 17);  if (!yymatchChar(yy, '~')) goto l130;  if (!yy__(yy)) goto l130;
+  YY_RULE_EPILOGUE(yy, 17, yypos0, 1);
   return 1;
-  l115:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[17];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "TILDE", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l130:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 17, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_prefix(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "prefix"));
-  {  int yypos117= yy->__pos, yythunkpos117= yy->__thunkpos;  if (!yy_AT(yy)) goto l118;  if (!yy_action(yy)) goto l118;  yyDo(yy, yy_1_prefix, yy->__begin, yy->__end);  goto l117;
-  l118:;	  yy->__pos= yypos117; yy->__thunkpos= yythunkpos117;  if (!yy_AND(yy)) goto l119;  if (!yy_action(yy)) goto l119;  yyDo(yy, yy_2_prefix, yy->__begin, yy->__end);  goto l117;
-  l119:;	  yy->__pos= yypos117; yy->__thunkpos= yythunkpos117;  if (!yy_AND(yy)) goto l120;  if (!yy_suffix(yy)) goto l120;  yyDo(yy, yy_3_prefix, yy->__begin, yy->__end);  goto l117;
-  l120:;	  yy->__pos= yypos117; yy->__thunkpos= yythunkpos117;  if (!yy_NOT(yy)) goto l121;  if (!yy_suffix(yy)) goto l121;  yyDo(yy, yy_4_prefix, yy->__begin, yy->__end);  goto l117;
-  l121:;	  yy->__pos= yypos117; yy->__thunkpos= yythunkpos117;  if (!yy_suffix(yy)) goto l116;
-  }
-  l117:;	
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[16];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "prefix", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 16);
+  {  int yypos132= yy->__pos, yythunkpos132= yy->__thunkpos;
+  YY_ALT_TRY(43);  if (!yy_AT(yy)) goto l133;  if (!yy_action(yy)) goto l133;  yyDo(yy, yy_1_prefix, yy->__begin, yy->__end);  YY_ALT_HIT(43);  goto l132;
+  l133:;	  YY_ALT_MISS(43, yypos132);  YY_HEAT(yy, yypos132);  yy->__pos= yypos132; yy->__thunkpos= yythunkpos132;
+  YY_ALT_TRY(44);  if (!yy_AND(yy)) goto l134;  if (!yy_action(yy)) goto l134;  yyDo(yy, yy_2_prefix, yy->__begin, yy->__end);  YY_ALT_HIT(44);  goto l132;
+  l134:;	  YY_ALT_MISS(44, yypos132);  YY_HEAT(yy, yypos132);  yy->__pos= yypos132; yy->__thunkpos= yythunkpos132;
+  YY_ALT_TRY(45);  if (!yy_AND(yy)) goto l135;  if (!yy_suffix(yy)) goto l135;  yyDo(yy, yy_3_prefix, yy->__begin, yy->__end);  YY_ALT_HIT(45);  goto l132;
+  l135:;	  YY_ALT_MISS(45, yypos132);  YY_HEAT(yy, yypos132);  yy->__pos= yypos132; yy->__thunkpos= yythunkpos132;
+  YY_ALT_TRY(46);  if (!yy_NOT(yy)) goto l136;  if (!yy_suffix(yy)) goto l136;  yyDo(yy, yy_4_prefix, yy->__begin, yy->__end);  YY_ALT_HIT(46);  goto l132;
+  l136:;	  YY_ALT_MISS(46, yypos132);  YY_HEAT(yy, yypos132);  yy->__pos= yypos132; yy->__thunkpos= yythunkpos132;
+  YY_ALT_TRY(47);  if (!yy_suffix(yy)) goto l137;  YY_ALT_HIT(47);  goto l132;
+  l137:;	  YY_ALT_MISS(47, yypos132);  goto l131;
+  }
+  l132:;	
+  YY_RULE_EPILOGUE(yy, 16, yypos0, 1);
   return 1;
-  l116:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[16];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "prefix", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l131:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 16, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_error(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "error"));  if (!yy_prefix(yy)) goto l122;
-  {  int yypos123= yy->__pos, yythunkpos123= yy->__thunkpos;  if (!yy_TILDE(yy)) goto l123;  if (!yy_action(yy)) goto l123;  yyDo(yy, yy_1_error, yy->__begin, yy->__end);  goto l124;
-  l123:;	  yy->__pos= yypos123; yy->__thunkpos= yythunkpos123;
+  YY_RULE_PROLOGUE(yy, 15);  if (!yy_prefix(yy)) goto l138;
+  {  int yypos139= yy->__pos, yythunkpos139= yy->__thunkpos;  if (!yy_TILDE(yy)) goto l139;  if (!yy_action(yy)) goto l139;  yyDo(yy, yy_1_error, yy->__begin, yy->__end);  goto l140;
+  l139:;	  YY_HEAT(yy, yypos139);  yy->__pos= yypos139; yy->__thunkpos= yythunkpos139;
   }
-  l124:;	
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[15];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "error", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l140:;	
+  YY_RULE_EPILOGUE(yy, 15, yypos0, 1);
   return 1;
-  l122:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[15];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "error", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l138:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 15, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_BAR(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "BAR"));  if (!yymatchChar(yy, '|')) goto l125;  if (!yy__(yy)) goto l125;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[14];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "BAR", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 14);  if (!yymatchChar(yy, '|')) goto l141;  if (!yy__(yy)) goto l141;
+  YY_RULE_EPILOGUE(yy, 14, yypos0, 1);
   return 1;
-  l125:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[14];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "BAR", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l141:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 14, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_sequence(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "sequence"));  if (!yy_error(yy)) goto l126;
-  l127:;	
-  {  int yypos128= yy->__pos, yythunkpos128= yy->__thunkpos;  if (!yy_error(yy)) goto l128;  yyDo(yy, yy_1_sequence, yy->__begin, yy->__end);  goto l127;
-  l128:;	  yy->__pos= yypos128; yy->__thunkpos= yythunkpos128;
+  YY_RULE_PROLOGUE(yy, 13);  if (!yy_error(yy)) goto l142;
+  l143:;	
+  {  int yypos144= yy->__pos, yythunkpos144= yy->__thunkpos;  if (!yy_error(yy)) goto l144;  yyDo(yy, yy_1_sequence, yy->__begin, yy->__end);  goto l143;
+  l144:;	  YY_HEAT(yy, yypos144);  yy->__pos= yypos144; yy->__thunkpos= yythunkpos144;
   }
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[13];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "sequence", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_EPILOGUE(yy, 13, yypos0, 1);
   return 1;
-  l126:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[13];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "sequence", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l142:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 13, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_SEMICOLON(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "SEMICOLON"));  if (!yymatchChar(yy, ';')) goto l129;  if (!yy__(yy)) goto l129;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[12];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "SEMICOLON", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 12);  if (!yymatchChar(yy, ';')) goto l145;  if (!yy__(yy)) goto l145;
+  YY_RULE_EPILOGUE(yy, 12, yypos0, 1);
   return 1;
-  l129:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[12];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "SEMICOLON", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l145:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 12, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_expression(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "expression"));  if (!yy_sequence(yy)) goto l130;
-  l131:;	
-  {  int yypos132= yy->__pos, yythunkpos132= yy->__thunkpos;  if (!yy_BAR(yy)) goto l132;  if (!yy_sequence(yy)) goto l132;  yyDo(yy, yy_1_expression, yy->__begin, yy->__end);  goto l131;
-  l132:;	  yy->__pos= yypos132; yy->__thunkpos= yythunkpos132;
+  YY_RULE_PROLOGUE(yy, 11);  if (!yy_sequence(yy)) goto l146;
+  l147:;	
+  {  int yypos148= yy->__pos, yythunkpos148= yy->__thunkpos;  if (!yy_BAR(yy)) goto l148;  if (!yy_sequence(yy)) goto l148;  yyDo(yy, yy_1_expression, yy->__begin, yy->__end);  goto l147;
+  l148:;	  YY_HEAT(yy, yypos148);  yy->__pos= yypos148; yy->__thunkpos= yythunkpos148;
   }
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[11];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "expression", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_EPILOGUE(yy, 11, yypos0, 1);
   return 1;
-  l130:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[11];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "expression", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l146:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 11, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_EQUAL(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "EQUAL"));  if (!yymatchChar(yy, '=')) goto l133;  if (!yy__(yy)) goto l133;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[10];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "EQUAL", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 10);  if (!yymatchChar(yy, '=')) goto l149;  if (!yy__(yy)) goto l149;
+  YY_RULE_EPILOGUE(yy, 10, yypos0, 1);
   return 1;
-  l133:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[10];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "EQUAL", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l149:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 10, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_identifier(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "identifier"));  yyText(yy, yy->__begin, yy->__end);  {
+  YY_RULE_PROLOGUE(yy, 9);  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
-if (!(YY_BEGIN)) goto l134;
+if (!(YY_BEGIN)) goto l150;
 #undef yytext
 #undef yyleng
-  }  if (!yy_identstart(yy)) goto l134;
-  l135:;	
-  {  int yypos136= yy->__pos, yythunkpos136= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\040\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l136;  goto l135;
-  l136:;	  yy->__pos= yypos136; yy->__thunkpos= yythunkpos136;
+  }  if (!yy_identstart(yy)) goto l150;
+  l151:;	
+  {  int yypos152= yy->__pos, yythunkpos152= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\040\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l152;  goto l151;
+  l152:;	  YY_HEAT(yy, yypos152);  yy->__pos= yypos152; yy->__thunkpos= yythunkpos152;
   }  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
-if (!(YY_END)) goto l134;
+if (!(YY_END)) goto l150;
 #undef yytext
 #undef yyleng
-  }  if (!yy__(yy)) goto l134;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[9];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "identifier", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  }  if (!yy__(yy)) goto l150;
+  YY_RULE_EPILOGUE(yy, 9, yypos0, 1);
   return 1;
-  l134:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[9];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "identifier", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l150:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 9, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_RPERCENT(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "RPERCENT"));  if (!yymatchString(yy, "%}")) goto l137;  if (!yy__(yy)) goto l137;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[8];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "RPERCENT", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 8);  if (!yymatchString(yy, "%}")) goto l153;  if (!yy__(yy)) goto l153;
+  YY_RULE_EPILOGUE(yy, 8, yypos0, 1);
   return 1;
-  l137:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[8];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "RPERCENT", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l153:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 8, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_end_of_line(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "end_of_line"));
-  {  int yypos139= yy->__pos, yythunkpos139= yy->__thunkpos;  if (!yymatchChar(yy, '\n')) goto l140;
-  {  int yypos141= yy->__pos, yythunkpos141= yy->__thunkpos;  if (!yymatchChar(yy, '\r')) goto l141;  goto l142;
-  l141:;	  yy->__pos= yypos141; yy->__thunkpos= yythunkpos141;
+  YY_RULE_PROLOGUE(yy, 7);
+  {  int yypos155= yy->__pos, yythunkpos155= yy->__thunkpos;
+  YY_ALT_TRY(48);  if (!yymatchChar(yy, '\n')) goto l156;
+  {  int yypos157= yy->__pos, yythunkpos157= yy->__thunkpos;  if (!yymatchChar(yy, '\r')) goto l157;  goto l158;
+  l157:;	  YY_HEAT(yy, yypos157);  yy->__pos= yypos157; yy->__thunkpos= yythunkpos157;
   }
-  l142:;	  goto l139;
-  l140:;	  yy->__pos= yypos139; yy->__thunkpos= yythunkpos139;  if (!yymatchChar(yy, '\r')) goto l138;
-  {  int yypos143= yy->__pos, yythunkpos143= yy->__thunkpos;  if (!yymatchChar(yy, '\n')) goto l143;  goto l144;
-  l143:;	  yy->__pos= yypos143; yy->__thunkpos= yythunkpos143;
+  l158:;	  YY_ALT_HIT(48);  goto l155;
+  l156:;	  YY_ALT_MISS(48, yypos155);  YY_HEAT(yy, yypos155);  yy->__pos= yypos155; yy->__thunkpos= yythunkpos155;
+  YY_ALT_TRY(49);  if (!yymatchChar(yy, '\r')) goto l159;
+  {  int yypos160= yy->__pos, yythunkpos160= yy->__thunkpos;  if (!yymatchChar(yy, '\n')) goto l160;  goto l161;
+  l160:;	  YY_HEAT(yy, yypos160);  yy->__pos= yypos160; yy->__thunkpos= yythunkpos160;
   }
-  l144:;	
+  l161:;	  YY_ALT_HIT(49);  goto l155;
+  l159:;	  YY_ALT_MISS(49, yypos155);  goto l154;
   }
-  l139:;	  yyDo(yy, yy_1_end_of_line, yy->__begin, yy->__end);
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[7];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "end_of_line", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l155:;	  yyDo(yy, yy_1_end_of_line, yy->__begin, yy->__end);
+  YY_RULE_EPILOGUE(yy, 7, yypos0, 1);
   return 1;
-  l138:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[7];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "end_of_line", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l154:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 7, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_end_of_file(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "end_of_file"));
-  {  int yypos146= yy->__pos, yythunkpos146= yy->__thunkpos;  if (!yymatchDot(yy)) goto l146;  goto l145;
-  l146:;	  yy->__pos= yypos146; yy->__thunkpos= yythunkpos146;
+  YY_RULE_PROLOGUE(yy, 6);
+  {  int yypos163= yy->__pos, yythunkpos163= yy->__thunkpos;  if (!yymatchDot(yy)) goto l163;  goto l162;
+  l163:;	  YY_HEAT(yy, yypos163);  yy->__pos= yypos163; yy->__thunkpos= yythunkpos163;
   }
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[6];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "end_of_file", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_EPILOGUE(yy, 6, yypos0, 1);
   return 1;
-  l145:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[6];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "end_of_file", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l162:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 6, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_trailer(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "trailer"));  if (!yymatchString(yy, "%%")) goto l147;  yyDo(yy, yy_1_trailer, yy->__begin, yy->__end);  yyText(yy, yy->__begin, yy->__end);  {
+  YY_RULE_PROLOGUE(yy, 5);  if (!yymatchString(yy, "%%")) goto l164;  yyDo(yy, yy_1_trailer, yy->__begin, yy->__end);  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
-if (!(YY_BEGIN)) goto l147;
+if (!(YY_BEGIN)) goto l164;
 #undef yytext
 #undef yyleng
   }
-  l148:;	
-  {  int yypos149= yy->__pos, yythunkpos149= yy->__thunkpos;  if (!yymatchDot(yy)) goto l149;  goto l148;
-  l149:;	  yy->__pos= yypos149; yy->__thunkpos= yythunkpos149;
+  l165:;	
+  {  int yypos166= yy->__pos, yythunkpos166= yy->__thunkpos;  if (!yymatchDot(yy)) goto l166;  goto l165;
+  l166:;	  YY_HEAT(yy, yypos166);  yy->__pos= yypos166; yy->__thunkpos= yythunkpos166;
   }  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
-if (!(YY_END)) goto l147;
+if (!(YY_END)) goto l164;
 #undef yytext
 #undef yyleng
   }  yyDo(yy, yy_2_trailer, yy->__begin, yy->__end);
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[5];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "trailer", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_EPILOGUE(yy, 5, yypos0, 1);
   return 1;
-  l147:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[5];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "trailer", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l164:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 5, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_definition(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "definition"));  yyDo(yy, yy_1_definition, yy->__begin, yy->__end);  if (!yy_identifier(yy)) goto l150;  yyDo(yy, yy_2_definition, yy->__begin, yy->__end);  if (!yy_EQUAL(yy)) goto l150;  if (!yy_expression(yy)) goto l150;  yyDo(yy, yy_3_definition, yy->__begin, yy->__end);
-  {  int yypos151= yy->__pos, yythunkpos151= yy->__thunkpos;  if (!yy_SEMICOLON(yy)) goto l151;  goto l152;
-  l151:;	  yy->__pos= yypos151; yy->__thunkpos= yythunkpos151;
+  YY_RULE_PROLOGUE(yy, 4);  yyDo(yy, yy_1_definition, yy->__begin, yy->__end);  if (!yy_identifier(yy)) goto l167;  yyDo(yy, yy_2_definition, yy->__begin, yy->__end);  if (!yy_EQUAL(yy)) goto l167;  if (!yy_expression(yy)) goto l167;  yyDo(yy, yy_3_definition, yy->__begin, yy->__end);
+  {  int yypos168= yy->__pos, yythunkpos168= yy->__thunkpos;  if (!yy_SEMICOLON(yy)) goto l168;  goto l169;
+  l168:;	  YY_HEAT(yy, yypos168);  yy->__pos= yypos168; yy->__thunkpos= yythunkpos168;
   }
-  l152:;	
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[4];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "definition", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l169:;	
+  YY_RULE_EPILOGUE(yy, 4, yypos0, 1);
   return 1;
-  l150:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[4];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "definition", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l167:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 4, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy_declaration(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "declaration"));  if (!yymatchString(yy, "%{")) goto l153;  yyDo(yy, yy_1_declaration, yy->__begin, yy->__end);  yyText(yy, yy->__begin, yy->__end);  {
+  YY_RULE_PROLOGUE(yy, 3);  if (!yymatchString(yy, "%{")) goto l170;  yyDo(yy, yy_1_declaration, yy->__begin, yy->__end);  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
-if (!(YY_BEGIN)) goto l153;
+if (!(YY_BEGIN)) goto l170;
 #undef yytext
 #undef yyleng
   }
-  l154:;	
-  {  int yypos155= yy->__pos, yythunkpos155= yy->__thunkpos;
-  {  int yypos156= yy->__pos, yythunkpos156= yy->__thunkpos;  if (!yymatchString(yy, "%}")) goto l156;  goto l155;
-  l156:;	  yy->__pos= yypos156; yy->__thunkpos= yythunkpos156;
+  l171:;	
+  {  int yypos172= yy->__pos, yythunkpos172= yy->__thunkpos;
+  {  int yypos173= yy->__pos, yythunkpos173= yy->__thunkpos;  if (!yymatchString(yy, "%}")) goto l173;  goto l172;
+  l173:;	  YY_HEAT(yy, yypos173);  yy->__pos= yypos173; yy->__thunkpos= yythunkpos173;
   }
-  {  int yypos157= yy->__pos, yythunkpos157= yy->__thunkpos;  if (!yy_end_of_line(yy)) goto l158;  goto l157;
-  l158:;	  yy->__pos= yypos157; yy->__thunkpos= yythunkpos157;  if (!yymatchDot(yy)) goto l155;
+  {  int yypos174= yy->__pos, yythunkpos174= yy->__thunkpos;
+  YY_ALT_TRY(50);  if (!yy_end_of_line(yy)) goto l175;  YY_ALT_HIT(50);  goto l174;
+  l175:;	  YY_ALT_MISS(50, yypos174);  YY_HEAT(yy, yypos174);  yy->__pos= yypos174; yy->__thunkpos= yythunkpos174;
+  YY_ALT_TRY(51);  if (!yymatchDot(yy)) goto l176;  YY_ALT_HIT(51);  goto l174;
+  l176:;	  YY_ALT_MISS(51, yypos174);  goto l172;
   }
-  l157:;	  goto l154;
-  l155:;	  yy->__pos= yypos155; yy->__thunkpos= yythunkpos155;
+  l174:;	  goto l171;
+  l172:;	  YY_HEAT(yy, yypos172);  yy->__pos= yypos172; yy->__thunkpos= yythunkpos172;
   }  yyText(yy, yy->__begin, yy->__end);  {
 #define yytext yy->__text
 #define yyleng yy->__textlen
-if (!(YY_END)) goto l153;
+if (!(YY_END)) goto l170;
 #undef yytext
 #undef yyleng
-  }  if (!yy_RPERCENT(yy)) goto l153;  yyDo(yy, yy_2_declaration, yy->__begin, yy->__end);
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[3];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "declaration", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  }  if (!yy_RPERCENT(yy)) goto l170;  yyDo(yy, yy_2_declaration, yy->__begin, yy->__end);
+  YY_RULE_EPILOGUE(yy, 3, yypos0, 1);
   return 1;
-  l153:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[3];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "declaration", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l170:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 3, yypos0, 0);
   return 0;
 }
 YY_RULE(int) yy__(yycontext *yy)
 {
-  yyprintf((stderr, "%s\n", "_"));
-  l160:;	
-  {  int yypos161= yy->__pos, yythunkpos161= yy->__thunkpos;
-  {  int yypos162= yy->__pos, yythunkpos162= yy->__thunkpos;  if (!yy_space(yy)) goto l163;
-  l164:;	
-  {  int yypos165= yy->__pos, yythunkpos165= yy->__thunkpos;  if (!yy_space(yy)) goto l165;  goto l164;
-  l165:;	  yy->__pos= yypos165; yy->__thunkpos= yythunkpos165;
-  }  goto l162;
-  l163:;	  yy->__pos= yypos162; yy->__thunkpos= yythunkpos162;  if (!yy_comment(yy)) goto l161;
-  }
-  l162:;	  goto l160;
-  l161:;	  yy->__pos= yypos161; yy->__thunkpos= yythunkpos161;
-  }
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[2];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "_", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 2);
+  l178:;	
+  {  int yypos179= yy->__pos, yythunkpos179= yy->__thunkpos;
+  {  int yypos180= yy->__pos, yythunkpos180= yy->__thunkpos;
+  YY_ALT_TRY(52);  if (!yy_space(yy)) goto l181;
+  l182:;	
+  {  int yypos183= yy->__pos, yythunkpos183= yy->__thunkpos;  if (!yy_space(yy)) goto l183;  goto l182;
+  l183:;	  YY_HEAT(yy, yypos183);  yy->__pos= yypos183; yy->__thunkpos= yythunkpos183;
+  }  YY_ALT_HIT(52);  goto l180;
+  l181:;	  YY_ALT_MISS(52, yypos180);  YY_HEAT(yy, yypos180);  yy->__pos= yypos180; yy->__thunkpos= yythunkpos180;
+  YY_ALT_TRY(53);  if (!yy_comment(yy)) goto l184;  YY_ALT_HIT(53);  goto l180;
+  l184:;	  YY_ALT_MISS(53, yypos180);  goto l179;
+  }
+  l180:;	  goto l178;
+  l179:;	  YY_HEAT(yy, yypos179);  yy->__pos= yypos179; yy->__thunkpos= yythunkpos179;
+  }
+  YY_RULE_EPILOGUE(yy, 2, yy->__pos, 1);
   return 1;
 }
 YY_RULE(int) yy_grammar(yycontext *yy)
 {  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
-  yyprintf((stderr, "%s\n", "grammar"));  if (!yy__(yy)) goto l166;
-  {  int yypos169= yy->__pos, yythunkpos169= yy->__thunkpos;  if (!yy_declaration(yy)) goto l170;  goto l169;
-  l170:;	  yy->__pos= yypos169; yy->__thunkpos= yythunkpos169;  if (!yy_definition(yy)) goto l166;
-  }
-  l169:;	
-  l167:;	
-  {  int yypos168= yy->__pos, yythunkpos168= yy->__thunkpos;
-  {  int yypos171= yy->__pos, yythunkpos171= yy->__thunkpos;  if (!yy_declaration(yy)) goto l172;  goto l171;
-  l172:;	  yy->__pos= yypos171; yy->__thunkpos= yythunkpos171;  if (!yy_definition(yy)) goto l168;
-  }
-  l171:;	  goto l167;
-  l168:;	  yy->__pos= yypos168; yy->__thunkpos= yythunkpos168;
-  }
-  {  int yypos173= yy->__pos, yythunkpos173= yy->__thunkpos;  if (!yy_trailer(yy)) goto l173;  goto l174;
-  l173:;	  yy->__pos= yypos173; yy->__thunkpos= yythunkpos173;
-  }
-  l174:;	  if (!yy_end_of_file(yy)) goto l166;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_succeed_count[1];
-#endif
-  yyprintf((stderr, "  ok   %s @%d:%d %s\n", "grammar", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  YY_RULE_PROLOGUE(yy, 1);  if (!yy__(yy)) goto l185;
+  {  int yypos188= yy->__pos, yythunkpos188= yy->__thunkpos;
+  YY_ALT_TRY(54);  if (!yy_declaration(yy)) goto l189;  YY_ALT_HIT(54);  goto l188;
+  l189:;	  YY_ALT_MISS(54, yypos188);  YY_HEAT(yy, yypos188);  yy->__pos= yypos188; yy->__thunkpos= yythunkpos188;
+  YY_ALT_TRY(55);  if (!yy_definition(yy)) goto l190;  YY_ALT_HIT(55);  goto l188;
+  l190:;	  YY_ALT_MISS(55, yypos188);  goto l185;
+  }
+  l188:;	
+  l186:;	
+  {  int yypos187= yy->__pos, yythunkpos187= yy->__thunkpos;
+  {  int yypos191= yy->__pos, yythunkpos191= yy->__thunkpos;
+  YY_ALT_TRY(54);  if (!yy_declaration(yy)) goto l192;  YY_ALT_HIT(54);  goto l191;
+  l192:;	  YY_ALT_MISS(54, yypos191);  YY_HEAT(yy, yypos191);  yy->__pos= yypos191; yy->__thunkpos= yythunkpos191;
+  YY_ALT_TRY(55);  if (!yy_definition(yy)) goto l193;  YY_ALT_HIT(55);  goto l191;
+  l193:;	  YY_ALT_MISS(55, yypos191);  goto l187;
+  }
+  l191:;	  goto l186;
+  l187:;	  YY_HEAT(yy, yypos187);  yy->__pos= yypos187; yy->__thunkpos= yythunkpos187;
+  }
+  {  int yypos194= yy->__pos, yythunkpos194= yy->__thunkpos;  if (!yy_trailer(yy)) goto l194;  goto l195;
+  l194:;	  YY_HEAT(yy, yypos194);  yy->__pos= yypos194; yy->__thunkpos= yythunkpos194;
+  }
+  l195:;	  if (!yy_end_of_file(yy)) goto l185;
+  YY_RULE_EPILOGUE(yy, 1, yypos0, 1);
   return 1;
-  l166:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
-#ifdef YY_RULES_PROFILE
-++yy->__rules_fail_count[1];
-#endif
-  yyprintf((stderr, "  fail %s @%d:%d %s\n", "grammar", yy->__lineno, yy->__inputpos-yy->__linenopos, yy->__buf+yy->__pos));
+  l185:;	  YY_HEAT(yy, yypos0);  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  YY_RULE_EPILOGUE(yy, 1, yypos0, 0);
   return 0;
 }
 
+#ifdef YY_RULES_PROFILE
+static const struct { int rule, line, index; } yyalternatives[YYALTCOUNT+1]= {
+  { 0, 0, 0 },
+  { 42, 171, 1 },
+  { 42, 171, 4 },
+  { 42, 171, 5 },
+  { 42, 171, 2 },
+  { 42, 171, 3 },
+  { 41, 170, 1 },
+  { 41, 170, 2 },
+  { 41, 170, 3 },
+  { 40, 148, 1 },
+  { 40, 148, 4 },
+  { 40, 148, 2 },
+  { 40, 148, 3 },
+  { 40, 148, 5 },
+  { 40, 148, 6 },
+  { 39, 144, 1 },
+  { 39, 144, 2 },
+  { 39, 144, 3 },
+  { 39, 144, 4 },
+  { 39, 144, 5 },
+  { 38, 131, 1 },
+  { 38, 131, 2 },
+  { 37, 133, 1 },
+  { 37, 133, 6 },
+  { 37, 133, 2 },
+  { 37, 133, 3 },
+  { 37, 133, 4 },
+  { 37, 133, 5 },
+  { 23, 104, 1 },
+  { 23, 104, 4 },
+  { 23, 104, 5 },
+  { 23, 104, 8 },
+  { 23, 104, 9 },
+  { 23, 104, 10 },
+  { 23, 104, 11 },
+  { 23, 104, 12 },
+  { 23, 104, 2 },
+  { 23, 104, 3 },
+  { 23, 104, 6 },
+  { 23, 104, 7 },
+  { 21, 99, 1 },
+  { 21, 99, 2 },
+  { 21, 99, 3 },
+  { 16, 93, 1 },
+  { 16, 93, 2 },
+  { 16, 93, 3 },
+  { 16, 93, 4 },
+  { 16, 93, 5 },
+  { 7, 176, 1 },
+  { 7, 176, 2 },
+  { 3, 70, 1 },
+  { 3, 70, 2 },
+  { 2, 169, 1 },
+  { 2, 169, 2 },
+  { 1, 68, 1 },
+  { 1, 68, 2 },
+};
+#endif
+
+
 #ifndef YY_PART
 
 typedef int (*yyrule)(yycontext *yy);
 
-YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)
+#ifdef YY_DEBUG
+YY_PARSE(void) yyDebugFilter(yycontext *yy, const char *rules, int from, int to)
 {
-  int yyok;
-  if (!yyctx->__buflen)
+  int i;
+  yy->__debugrules[0]= !rules;	/* tracing outside any rule */
+  for (i= 1;  i <= YYRULECOUNT;  ++i)
     {
-      yyctx->__buflen= YY_BUFFER_SIZE;
-      yyctx->__buf= (char *)YY_MALLOC(yyctx, yyctx->__buflen);
-#ifdef YY_DEBUG
-      memset(yyctx->__buf, 0, yyctx->__buflen);
+      const char *p= rules;
+      size_t n= strlen(yyrulenames[i]);
+      yy->__debugrules[i]= 0;
+      for (;  p && (p= strstr(p, yyrulenames[i]));  p += n)
+	if ((p == rules || strchr(", \t", p[-1])) && strchr(", \t", p[n]))
+	  {
+	    yy->__debugrules[i]= 1;
+	    break;
+	  }
+    }
+  yy->__debugactive= yy->__debugrules[0];
+  yy->__debugfrom= from;
+  yy->__debugto= to;
+  yy->__debugset= 1;
+}
 #endif
-      yyctx->__textlen= YY_BUFFER_SIZE;
-      yyctx->__text= (char *)YY_MALLOC(yyctx, yyctx->__textlen);
-      yyctx->__thunkslen= YY_STACK_SIZE;
-      yyctx->__thunks= (yythunk *)YY_MALLOC(yyctx, sizeof(yythunk) * yyctx->__thunkslen);
-      yyctx->__valslen= YY_STACK_SIZE;
-      yyctx->__vals= (YYSTYPE *)YY_MALLOC(yyctx, sizeof(YYSTYPE) * yyctx->__valslen);
-      yyctx->__begin= yyctx->__end= yyctx->__pos= yyctx->__limit= yyctx->__thunkpos= 0;
+
+YY_LOCAL(void) yyInit(yycontext *yy)
+{
+  yy->__buflen= YY_BUFFER_SIZE;
+  yy->__buf= (char *)YY_MALLOC(yy, yy->__buflen);
+#ifdef YY_DEBUG
+  memset(yy->__buf, 0, yy->__buflen);
+  if (!yy->__debugset)
+    {
+      const char *range= getenv("YY_DEBUG_RANGE");
+      int from= 0, to= 0;
+      if (range) sscanf(range, "%d-%d", &from, &to);
+      yyDebugFilter(yy, getenv("YY_DEBUG_RULES"), from, to);
     }
-  yyctx->__begin= yyctx->__end= yyctx->__pos;
+#endif
+  yy->__textlen= YY_BUFFER_SIZE;
+  yy->__text= (char *)YY_MALLOC(yy, yy->__textlen);
+#if !defined(YY_RECOGNIZER) || defined(YY_EVENTS) || defined(YY_AST)
+  yy->__thunkslen= YY_STACK_SIZE;
+  yy->__thunks= (yythunk *)YY_MALLOC(yy, sizeof(yythunk) * yy->__thunkslen);
+#endif
+#ifndef YY_RECOGNIZER
+  yy->__valslen= YY_STACK_SIZE;
+  yy->__vals= (YYSTYPE *)YY_MALLOC(yy, sizeof(YYSTYPE) * yy->__valslen);
+#endif
+  yy->__begin= yy->__end= yy->__pos= yy->__limit= yy->__thunkpos= 0;
+}
+
+YY_LOCAL(int) yyMatch(yycontext *yy, yyrule yystart)
+{
+  int yyok;
+  yy->__begin= yy->__end= yy->__pos;
+  yyValReset(yy);
+#if defined(YY_BUDGET) || defined(YY_MAX_DEPTH)
+  yy->__abort= 0;
+#endif
+#ifdef YY_BUDGET
+  yy->__steps= 0;
+  yy->__deadline= yy->__maxclock ? YY_BUDGET_CLOCK() + yy->__maxclock : 0;
+#endif
+#ifdef YY_MAX_DEPTH
+  yy->__depth= 0;
+#endif
+  yyok= yystart(yy);
+#if defined(YY_BUDGET) || defined(YY_MAX_DEPTH)
+  if (yy->__abort) yyok= -yy->__abort;
+#endif
+  return yyok;
+}
+
+YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)
+{
+  int yyok;
+  if (!yyctx->__buflen)
+    yyInit(yyctx);
   yyctx->__thunkpos= 0;
-  yyctx->__val= yyctx->__vals;
-  yyok= yystart(yyctx);
-  if (yyok) yyDone(yyctx);
+#ifdef YY_AST
+  yyctx->__astcount= 0;
+  yyctx->__astparent= -1;
+#endif
+  yyok= yyMatch(yyctx, yystart);
+  if (yyok > 0) yyDone(yyctx);
   yyCommit(yyctx);
   return yyok;
 }
@@ -1943,8 +2898,186 @@ YY_PARSE(int) YYPARSE(YY_CTX_PARAM)
   return YYPARSEFROM(YY_CTX_ARG_ yy_grammar);
 }
 
+YY_PARSE(int) YYPARSEMANYFROM(YY_CTX_PARAM_ yyrule yystart, int yymax)
+{
+  int yycount= 0, yybatch= 0;
+  if (!yyctx->__buflen)
+    yyInit(yyctx);
+  yyctx->__thunkpos= 0;
+#ifdef YY_AST
+  yyctx->__astcount= 0;
+  yyctx->__astparent= -1;
+#endif
+  while (yymax <= 0 || yycount < yymax)
+    {
+      int yypos= yyctx->__pos, yythunkpos= yyctx->__thunkpos;
+      if (yyMatch(yyctx, yystart) <= 0)	/* an abort stays visible in __abort */
+        {
+          yyctx->__pos= yypos;
+          yyctx->__thunkpos= yythunkpos;
+          break;
+        }
+      ++yycount;
+      if (yyctx->__pos == yypos)
+        break;
+      if (++yybatch == YY_BATCH_SIZE)
+        {
+          yyValReset(yyctx);
+          yyDone(yyctx);
+          yyCommit(yyctx);
+          yybatch= 0;
+        }
+    }
+  yyValReset(yyctx);
+  yyDone(yyctx);
+  yyCommit(yyctx);
+  return yycount;
+}
+
+YY_PARSE(int) YYPARSEMANY(YY_CTX_PARAM_ int yymax)
+{
+  return YYPARSEMANYFROM(YY_CTX_ARG_ yy_grammar, yymax);
+}
+
+#ifdef YY_FIND
+YY_LOCAL(int) yyFindStart(yycontext *yy, const unsigned char *yyfirst, int yyc)
+{
+  const unsigned char *yyp= (const unsigned char *)yy->__buf + yy->__pos;
+  const unsigned char *yye= (const unsigned char *)yy->__buf + yy->__limit;
+  if (yyc >= 0)
+    yyp= (const unsigned char *)memchr(yyp, yyc, yye - yyp);
+  else
+    {
+      while (yyp < yye && !(yyfirst[*yyp >> 3] & (1 << (*yyp & 7)))) ++yyp;
+      if (yyp == yye) yyp= 0;
+    }
+  return yyp ? (int)(yyp - (const unsigned char *)yy->__buf) : -1;
+}
+
+YY_PARSE(int) YYFIND(YY_CTX_PARAM_ yyrule yystart, int yymax)
+{
+  const unsigned char *yyfirst= 0;
+  int yycount= 0, yyc= -1, yyi;
+  if (!yyctx->__buflen)
+    yyInit(yyctx);
+  for (yyi= 1;  yyi <= YYRULECOUNT;  ++yyi)
+    if (yyfindrules[yyi] == yystart)
+      yyfirst= (const unsigned char *)yyfirstsets[yyi];
+  for (yyi= 0;  yyfirst && yyi < 256;  ++yyi)
+    if (yyfirst[yyi >> 3] & (1 << (yyi & 7)))
+      yyc= (yyc == -1) ? yyi : -2;
+  yyctx->__thunkpos= 0;
+  while (yymax <= 0 || yycount < yymax)
+    {
+      int yypos;
+      if (yyctx->__pos >= yyctx->__limit)
+        {
+          yyctx->__base += yyctx->__pos;
+          yyctx->__pos= yyctx->__limit= 0;
+          if (!yyrefill(yyctx)) break;
+        }
+      if (yyfirst)
+        {
+          if ((yypos= yyFindStart(yyctx, yyfirst, yyc)) < 0)
+            {
+              yyctx->__pos= yyctx->__limit;
+              continue;
+            }
+          yyctx->__pos= yypos;
+        }
+      yypos= yyctx->__pos;
+      if (yyMatch(yyctx, yystart) > 0 && yyctx->__pos > yypos)
+        {
+          ++yycount;
+          YY_FOUND(yyctx, yyctx->__base + yypos, yyctx->__base + yyctx->__pos);
+          yyValReset(yyctx);
+          yyDone(yyctx);
+        }
+      else
+        {
+          yyctx->__pos= yypos + 1;
+          yyctx->__thunkpos= 0;
+        }
+    }
+  return yycount;
+}
+#endif
+
+#ifdef YY_PIPELINE
+YY_LOCAL(void *) yyPipelineWorker(void *yyarg)
+{
+  yypipeline *p= (yypipeline *)yyarg;
+  yycontext *yy= p->__ctx;
+  for (;;)
+    {
+      yybatch *b= yyPipelineGet(p, p->__full, &p->__fullhead, &p->__fulltail, &p->__fullcond, 1);
+      int yyi;
+      if (!b) break;	/* stopped with nothing left to run */
+      if (b->__reset) yy->__val= yy->__vals;
+      for (yyi= 0;  yyi < b->__count;  ++yyi)
+        {
+          yyentry *e= &b->__entries[yyi];
+          e->action(yy, e->text < 0 ? b->__text : b->__text + e->text, e->leng);
+        }
+      yyPipelinePut(p, p->__free, &p->__freetail, &p->__freecond, b);
+    }
+  return 0;
+}
+
+YY_PARSE(int) YYPIPELINESTART(yycontext *yyctx)
+{
+  yypipeline *p;
+  if (yyctx->__pipeline) return 1;
+  if (!yyctx->__buflen)
+    yyInit(yyctx);
+  p= (yypipeline *)YY_MALLOC(yyctx, sizeof(yypipeline));
+  memset(p, 0, sizeof(yypipeline));
+  p->__ctx= yyctx;
+  pthread_mutex_init(&p->__lock, 0);
+  pthread_cond_init(&p->__fullcond, 0);
+  pthread_cond_init(&p->__freecond, 0);
+  if (pthread_create(&p->__consumer, 0, yyPipelineWorker, p))
+    {
+      pthread_cond_destroy(&p->__freecond);
+      pthread_cond_destroy(&p->__fullcond);
+      pthread_mutex_destroy(&p->__lock);
+      YY_FREE(yyctx, p);
+      return 0;
+    }
+  yyctx->__pipeline= p;
+  return 1;
+}
+
+YY_PARSE(void) YYPIPELINEFINISH(yycontext *yyctx)
+{
+  yypipeline *p= yyctx->__pipeline;
+  int yyi;
+  if (!p) return;
+  pthread_mutex_lock(&p->__lock);
+  p->__stop= 1;
+  pthread_cond_signal(&p->__fullcond);
+  pthread_mutex_unlock(&p->__lock);
+  pthread_join(p->__consumer, 0);
+  pthread_cond_destroy(&p->__freecond);
+  pthread_cond_destroy(&p->__fullcond);
+  pthread_mutex_destroy(&p->__lock);
+  if (p->__reset) yyctx->__val= yyctx->__vals;
+  for (yyi= 0;  yyi < p->__count;  ++yyi)
+    {
+      YY_FREE(yyctx, p->__batches[yyi]->__entries);
+      YY_FREE(yyctx, p->__batches[yyi]->__text);
+      YY_FREE(yyctx, p->__batches[yyi]);
+    }
+  YY_FREE(yyctx, p);
+  yyctx->__pipeline= 0;
+}
+#endif
+
 YY_PARSE(yycontext *) YYRELEASE(yycontext *yyctx)
 {
+#ifdef YY_PIPELINE
+  YYPIPELINEFINISH(yyctx);
+#endif
   if (yyctx->__buflen)
     {
       yyctx->__buflen= 0;
@@ -1953,28 +3086,582 @@ YY_PARSE(yycontext *) YYRELEASE(yycontext *yyctx)
       YY_FREE(yyctx, yyctx->__thunks);
       YY_FREE(yyctx, yyctx->__vals);
     }
+#ifdef YY_VM
+  if (yyctx->__frameslen)
+    {
+      yyctx->__frameslen= 0;
+      YY_FREE(yyctx, yyctx->__frames);
+    }
+#endif
+#ifdef YY_AST
+  if (yyctx->__astlen)
+    {
+      yyctx->__astlen= yyctx->__astcount= 0;
+      YY_FREE(yyctx, yyctx->__ast);
+    }
+#endif
+#ifdef YY_ARENA
+  yyArenaReset(yyctx, 0);
+#endif
+#ifdef YY_SAMPLER
+  if (yysampled == yyctx) yyStopSampler(yyctx);
+  YY_FREE(yyctx, yyctx->__samples);
+  yyctx->__samples= 0;
+  yyctx->__sampleslen= 0;
+#endif
+#ifdef YY_HEATMAP
+  if (yyctx->__heatsize)
+    {
+      yyctx->__heatsize= yyctx->__heatlen= 0;
+      YY_FREE(yyctx, yyctx->__heat);
+      YY_FREE(yyctx, yyctx->__heattext);
+    }
+#endif
   return yyctx;
 }
+
+#ifdef YY_AST
+YY_PARSE(yynode *) YYAST(yycontext *yyctx, int *yycount)
+{
+  if (yycount) *yycount= yyctx->__astcount;
+  return yyctx->__ast;
+}
+#endif
+
+#ifdef YY_HEATMAP
+YY_PARSE(int *) YYHEATMAP(yycontext *yyctx, int *yylength)
+{
+  if (yylength) *yylength= yyctx->__heatlen;
+  return yyctx->__heat;
+}
+#endif
+
+YY_PARSE(yycontext *) YYRESET(yycontext *yyctx)
+{
+  if (yyctx->__buflen > YY_RESET_LIMIT)
+    {
+      yyctx->__buflen= YY_BUFFER_SIZE;
+      yyctx->__buf= (char *)YY_REALLOC(yyctx, yyctx->__buf, yyctx->__buflen);
+    }
+  if (yyctx->__textlen > YY_RESET_LIMIT)
+    {
+      yyctx->__textlen= YY_BUFFER_SIZE;
+      yyctx->__text= (char *)YY_REALLOC(yyctx, yyctx->__text, yyctx->__textlen);
+    }
+  if (sizeof(yythunk) * yyctx->__thunkslen > YY_RESET_LIMIT)
+    {
+      yyctx->__thunkslen= YY_STACK_SIZE;
+      yyctx->__thunks= (yythunk *)YY_REALLOC(yyctx, yyctx->__thunks, sizeof(yythunk) * yyctx->__thunkslen);
+    }
+  if (sizeof(YYSTYPE) * yyctx->__valslen > YY_RESET_LIMIT)
+    {
+      yyctx->__valslen= YY_STACK_SIZE;
+      yyctx->__vals= (YYSTYPE *)YY_REALLOC(yyctx, yyctx->__vals, sizeof(YYSTYPE) * yyctx->__valslen);
+    }
+#ifdef YY_VM
+  if (sizeof(yyframe) * yyctx->__frameslen > YY_RESET_LIMIT)
+    {
+      yyctx->__frameslen= YY_STACK_SIZE;
+      yyctx->__frames= (yyframe *)YY_REALLOC(yyctx, yyctx->__frames, sizeof(yyframe) * yyctx->__frameslen);
+    }
+  yyctx->__framepos= 0;
+#endif
+#ifdef YY_AST
+  if (sizeof(yynode) * yyctx->__astlen > YY_RESET_LIMIT)
+    {
+      yyctx->__astlen= YY_STACK_SIZE;
+      yyctx->__ast= (yynode *)YY_REALLOC(yyctx, yyctx->__ast, sizeof(yynode) * yyctx->__astlen);
+    }
+  yyctx->__astcount= 0;
+#endif
+#if defined(YY_AST) || defined(YY_EVENTS) || defined(YY_FIND) || defined(YY_HEATMAP) || defined(YY_TRACE) || defined(YY_DEBUG) || defined(YY_PROBES)
+  yyctx->__base= 0;
+#endif
+#ifdef YY_HEATMAP
+  yyctx->__heatlen= 0;
+#endif
+#ifdef YY_RULE_STACK
+  yyctx->__stackdepth= 0;
+#endif
+#ifdef YY_TRACE
+  yyctx->__tracecount= 0;
+  yyctx->__tracedepth= 0;
+#endif
+#ifdef YY_ARENA
+  yyArenaReset(yyctx, YY_RESET_LIMIT);
+#endif
+#ifdef YY_DEBUG
+  if (yyctx->__buflen) memset(yyctx->__buf, 0, yyctx->__buflen);
+  yyctx->__calldepth= 0;
+  yyctx->__debugactive= yyctx->__debugrules[0];
+#endif
+  yyctx->__begin= yyctx->__end= yyctx->__pos= yyctx->__limit= yyctx->__thunkpos= 0;
+  yyctx->__inputpos= yyctx->__lineno= yyctx->__linenopos= 0;
+  return yyctx;
+}
+
+#ifdef YY_CTX_LOCAL
+YY_PARSE(yycontext *) YYCREATE(void)
+{
+  return (yycontext *)calloc(1, sizeof(yycontext));
+}
+#endif
+
+#if defined(YY_POOL) && defined(YY_CTX_LOCAL)
+YY_LOCAL(void) yyPoolMark(int *mark, int value)
+{
+  int old= __atomic_load_n(mark, __ATOMIC_RELAXED);
+  while (value > old && !__atomic_compare_exchange_n(mark, &old, value, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    ;
+}
+
+YY_LOCAL(int) yyPoolSize(int *mark, int initial, int size)
+{
+  int n= __atomic_load_n(mark, __ATOMIC_RELAXED);
+  if ((long)n * size > YY_RESET_LIMIT) n= YY_RESET_LIMIT / size;
+  return n > initial ? n : initial;
+}
+
+YY_PARSE(yycontext *) YYACQUIRE(yypool *yyp)
+{
+  yycontext *yyctx;
+  int i;
+  for (i= 0;  i < YY_POOL_SIZE;  ++i)
+    if (__atomic_load_n(&yyp->__contexts[i], __ATOMIC_RELAXED)
+        && (yyctx= __atomic_exchange_n(&yyp->__contexts[i], 0, __ATOMIC_ACQUIRE)))
+      return yyctx;
+  if (!(yyctx= YYCREATE()))
+    return 0;
+  yyctx->__buflen= yyPoolSize(&yyp->__buflen, YY_BUFFER_SIZE, 1);
+  yyctx->__buf= (char *)YY_MALLOC(yyctx, yyctx->__buflen);
+#ifdef YY_DEBUG
+  memset(yyctx->__buf, 0, yyctx->__buflen);
+#endif
+  yyctx->__textlen= yyPoolSize(&yyp->__textlen, YY_BUFFER_SIZE, 1);
+  yyctx->__text= (char *)YY_MALLOC(yyctx, yyctx->__textlen);
+  yyctx->__thunkslen= yyPoolSize(&yyp->__thunkslen, YY_STACK_SIZE, sizeof(yythunk));
+  yyctx->__thunks= (yythunk *)YY_MALLOC(yyctx, sizeof(yythunk) * yyctx->__thunkslen);
+  yyctx->__valslen= yyPoolSize(&yyp->__valslen, YY_STACK_SIZE, sizeof(YYSTYPE));
+  yyctx->__vals= (YYSTYPE *)YY_MALLOC(yyctx, sizeof(YYSTYPE) * yyctx->__valslen);
+  return yyctx;
+}
+
+YY_PARSE(void) YYRECYCLE(yypool *yyp, yycontext *yyctx)
+{
+  int i;
+  yyPoolMark(&yyp->__buflen, yyctx->__buflen);
+  yyPoolMark(&yyp->__textlen, yyctx->__textlen);
+  yyPoolMark(&yyp->__thunkslen, yyctx->__thunkslen);
+  yyPoolMark(&yyp->__valslen, yyctx->__valslen);
+  YYRESET(yyctx);
+  for (i= 0;  i < YY_POOL_SIZE;  ++i)
+    {
+      yycontext *yyempty= 0;
+      if (__atomic_compare_exchange_n(&yyp->__contexts[i], &yyempty, yyctx, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        return;
+    }
+  free(YYRELEASE(yyctx));
+}
+
+YY_PARSE(void) YYDRAIN(yypool *yyp)
+{
+  int i;
+  for (i= 0;  i < YY_POOL_SIZE;  ++i)
+    {
+      yycontext *yyctx= __atomic_exchange_n(&yyp->__contexts[i], 0, __ATOMIC_ACQUIRE);
+      if (yyctx) free(YYRELEASE(yyctx));
+    }
+}
+#endif
+
+#ifdef YY_PARALLEL
+typedef struct _yychunk {
+  yycontext  __ctx;
+  int        __begin;
+  int        __end;
+  int        __records;
+} yychunk;
+
+typedef struct _yyparallel {
+  yychunk   *__chunks;
+  int        __count;
+  int        __next;
+  yyrule     __start;
+} yyparallel;
+
+YY_LOCAL(void) yyChunkInit(yycontext *yyctx, yycontext *yy, const char *yyinput, int yylength)
+{
+  *yy= *yyctx;
+  yy->__buflen= 0;
+#ifdef YY_VM
+  yy->__frames= 0;
+  yy->__frameslen= yy->__framepos= 0;
+#endif
+#ifdef YY_PIPELINE
+  yy->__pipeline= 0;
+#endif
+#ifdef YY_AST
+  yy->__ast= 0;
+  yy->__astlen= yy->__astcount= 0;
+#endif
+#ifdef YY_ARENA
+  yy->__arena= yy->__arenacur= 0;
+#endif
+#ifdef YY_HEATMAP
+  yy->__heat= 0;
+  yy->__heattext= 0;
+  yy->__heatlen= yy->__heatsize= 0;
+#endif
+#ifdef YY_RULE_STACK
+  yy->__stackdepth= 0;
+#endif
+#ifdef YY_SAMPLER
+  yy->__samples= 0;
+  yy->__sampleslen= yy->__samplesdropped= 0;
+#endif
+#ifdef YY_TRACE
+  yy->__tracecount= 0;
+  yy->__tracedepth= 0;
+#endif
+  yyInit(yy);
+  if (yylength >= yy->__buflen)
+    {
+      yy->__buflen= yylength + 1;
+      yy->__buf= (char *)YY_REALLOC(yy, yy->__buf, yy->__buflen);
+    }
+  memcpy(yy->__buf, yyinput, yylength);
+  yy->__buf[yylength]= '\0';
+  yy->__limit= yylength;
+  yy->__resident= 1;
+  yy->__inputpos= yy->__lineno= yy->__linenopos= 0;
+}
+
+YY_LOCAL(int) yySyncPoint(yycontext *yyctx, const char *yyinput, int yyfrom, int yyto, yyrule yysync)
+{
+  yycontext yy;
+  int yypos, yyresult= -1;
+  yyChunkInit(yyctx, &yy, yyinput + yyfrom, yyto - yyfrom);
+  for (yypos= 0;  yypos < yy.__limit;  ++yypos)
+    {
+      yy.__begin= yy.__end= yy.__pos= yypos;
+      yy.__thunkpos= 0;
+      yy.__val= yy.__vals;
+      if (yysync(&yy) && yy.__pos > yypos)
+        {
+          yyresult= yyfrom + yy.__pos;
+          break;
+        }
+    }
+  YYRELEASE(&yy);
+  return yyresult;
+}
+
+YY_LOCAL(void *) yyChunkWorker(void *yyarg)
+{
+  yyparallel *yyp= (yyparallel *)yyarg;
+  int yyi;
+  while ((yyi= __atomic_fetch_add(&yyp->__next, 1, __ATOMIC_RELAXED)) < yyp->__count)
+    {
+      yychunk   *yyc= &yyp->__chunks[yyi];
+      yycontext *yy= &yyc->__ctx;
+      while (yy->__pos < yy->__limit)
+        {
+          int yypos= yy->__pos;
+          if (yyMatch(yy, yyp->__start) <= 0 || yy->__pos == yypos) break;
+          ++yyc->__records;
+        }
+      if (yy->__pos < yy->__limit) yyc->__records= -1;
+    }
+  return 0;
+}
+
+YY_PARSE(int) YYPARSEPARALLEL(yycontext *yyctx, const char *yyinput, int yylength, yyrule yystart, yyrule yysync, int yythreads)
+{
+  yyparallel yyp;
+  pthread_t *yytids;
+  int yyi, yypos, yyrecords= 0;
+  int yymax= (yythreads > 0 ? yythreads : 1) * YY_PARALLEL_CHUNKS;
+  int yysize= yylength / yymax + 1;
+  if (!yyctx->__buflen)
+    yyInit(yyctx);
+  yyp.__chunks= (yychunk *)YY_MALLOC(yyctx, sizeof(yychunk) * yymax);
+  yyp.__count= yyp.__next= 0;
+  yyp.__start= yystart;
+  for (yypos= 0;  yypos < yylength;  )
+    {
+      int yyend= yylength;
+      if (yyp.__count < yymax - 1 && yypos + yysize < yylength)
+        {
+          int yyto= yypos + 2 * yysize < yylength ? yypos + 2 * yysize : yylength;
+          if ((yyend= yySyncPoint(yyctx, yyinput, yypos + yysize, yyto, yysync)) < 0 && yyto < yylength)
+            yyend= yySyncPoint(yyctx, yyinput, yypos + yysize, yylength, yysync);
+          if (yyend < 0)	/* no record boundary left: this chunk takes the rest */
+            yyend= yylength;
+        }
+      yyp.__chunks[yyp.__count].__begin= yypos;
+      yyp.__chunks[yyp.__count].__end= yyend;
+      yyp.__chunks[yyp.__count].__records= 0;
+      yyChunkInit(yyctx, &yyp.__chunks[yyp.__count].__ctx, yyinput + yypos, yyend - yypos);
+      ++yyp.__count;
+      yypos= yyend;
+    }
+  if (yythreads > yyp.__count) yythreads= yyp.__count;
+  yytids= (pthread_t *)YY_MALLOC(yyctx, sizeof(pthread_t) * (yythreads > 0 ? yythreads : 1));
+  for (yyi= 1;  yyi < yythreads;  ++yyi)
+    if (pthread_create(&yytids[yyi], 0, yyChunkWorker, &yyp))
+      break;
+  yythreads= yyi;
+  yyChunkWorker(&yyp);
+  for (yyi= 1;  yyi < yythreads;  ++yyi)
+    pthread_join(yytids[yyi], 0);
+  YY_FREE(yyctx, yytids);
+  for (yyi= 0;  yyi < yyp.__count && yyrecords >= 0;  ++yyi)
+    yyrecords= yyp.__chunks[yyi].__records < 0 ? -1 : yyrecords + yyp.__chunks[yyi].__records;
+  for (yyi= 0;  yyi < yyp.__count;  ++yyi)
+    {
+      yycontext *yy= &yyp.__chunks[yyi].__ctx;
+      int yypos;
+      yyctx->__val= yyctx->__vals;
+      if (yyrecords >= 0)
+        for (yypos= 0;  yypos < yy->__thunkpos;  ++yypos)
+          {
+            yythunk *yyt= &yy->__thunks[yypos];
+            int yyleng= yyt->end ? yyText(yy, yyt->begin, yyt->end) : yyt->begin;
+            yyt->action(yyctx, yy->__text, yyleng);
+          }
+      YYRELEASE(yy);
+    }
+  YY_FREE(yyctx, yyp.__chunks);
+  return yyrecords;
+}
+#endif
 #ifdef YY_RULES_PROFILE
 
 YY_PARSE(int) yyShowRulesProfile(yycontext *yy, FILE *fp)
 {
-  int itotal_def_count = 0, itotal_def_succ_count = 0, itotal_def_fail_count = 0;
+  yycount itotal_def_count = 0, itotal_def_succ_count = 0, itotal_def_fail_count = 0;
   for(int i=1; i <= YYRULECOUNT; ++i) {
     itotal_def_succ_count += yy->__rules_succeed_count[i];
     itotal_def_fail_count += yy->__rules_fail_count[i];
   }
   itotal_def_count += itotal_def_succ_count + itotal_def_fail_count;
   double dtotal_count = itotal_def_count;
-  fprintf(fp, "Total calls %d,  calls per input byte %.2f\n\n", itotal_def_count, (itotal_def_count/(yy->__inputpos*1.0)));
+  fprintf(fp, "Total calls %llu,  calls per input byte %.2f\n\n", itotal_def_count,
+	  yy->__rules_input ? itotal_def_count / (double)yy->__rules_input : 0.0);
   fprintf(fp, "%4s  %10s  %5s  %10s  %10s  %s\n", "id", "total", "%", "success", "fail", "definition");
-  fprintf(fp, "\n%4s  %10.d  %5s  %10.d  %10.d  Total counters", "", itotal_def_count, "", itotal_def_succ_count, itotal_def_fail_count);
+  fprintf(fp, "\n%4s  %10.llu  %5s  %10.llu  %10.llu  Total counters", "", itotal_def_count, "", itotal_def_succ_count, itotal_def_fail_count);
   fprintf(fp, "\n%4s  %12s  %5s  %8.2f  %10.2f  %% success/fail\n\n", "", "", "", (itotal_def_succ_count/dtotal_count)*100.0, (itotal_def_fail_count/dtotal_count)*100.0);
   for(int i=1; i <= YYRULECOUNT; ++i) {
-    int def_count = yy->__rules_succeed_count[i] + yy->__rules_fail_count[i];
-    fprintf(fp, "%4.d  %10.d  %5.2f  %10.d  %10.d  %s\n", i, def_count, (def_count/dtotal_count)*100.0,
+    yycount def_count = yy->__rules_succeed_count[i] + yy->__rules_fail_count[i];
+    fprintf(fp, "%4.d  %10.llu  %5.2f  %10.llu  %10.llu  %s\n", i, def_count, (def_count/dtotal_count)*100.0,
 	    yy->__rules_succeed_count[i], yy->__rules_fail_count[i], yyrulenames[i]);
   }
+  yytime total_time = 0;
+  int order[YYRULECOUNT+1], n = 0;
+  for(int i=1; i <= YYRULECOUNT; ++i) {
+    int j = n++;
+    total_time += yy->__rules_self_time[i];
+    while (j > 0 && yy->__rules_self_time[order[j-1]] < yy->__rules_self_time[i]) {
+      order[j] = order[j-1];
+      --j;
+    }
+    order[j] = i;
+  }
+  fprintf(fp, "\nTotal time %llu " YY_PROFILE_UNIT "\n\n", total_time);
+  fprintf(fp, "%4s  %14s  %6s  %14s  %10s  %s\n", "id", "self", "%", "inclusive", "calls", "definition");
+  for(int k=0; k < n; ++k) {
+    int i = order[k];
+    fprintf(fp, "%4d  %14llu  %6.2f  %14llu  %10llu  %s\n", i, yy->__rules_self_time[i],
+	    total_time ? yy->__rules_self_time[i] * 100.0 / total_time : 0.0, yy->__rules_total_time[i],
+	    yy->__rules_succeed_count[i] + yy->__rules_fail_count[i], yyrulenames[i]);
+  }
+#ifndef YY_VM
+  int alts[YYALTCOUNT+1], m = 0;
+  for(int a=1; a <= YYALTCOUNT; ++a) {
+    int j = m;
+    if (!yy->__alt_tries[a]) continue;
+    ++m;
+    while (j > 0 && yy->__alt_waste[alts[j-1]] < yy->__alt_waste[a]) {
+      alts[j] = alts[j-1];
+      --j;
+    }
+    alts[j] = a;
+  }
+  fprintf(fp, "\n%6s  %10s  %10s  %6s  %12s  %s\n", "line", "tries", "hits", "fail%", "wasted", "alternative");
+  for(int k=0; k < m; ++k) {
+    int a = alts[k];
+    yycount tries = yy->__alt_tries[a];
+    fprintf(fp, "%6d  %10llu  %10llu  %6.2f  %12llu  %s/%d\n", yyalternatives[a].line, tries, yy->__alt_hits[a],
+	    (tries - yy->__alt_hits[a]) * 100.0 / tries, yy->__alt_waste[a], yyrulenames[yyalternatives[a].rule], yyalternatives[a].index);
+  }
+#endif
+  return 0;
+}
+
+/* Machine-readable profiles.  Every column is a plain count, so that
+ * profiles of the same grammar from several processes can be added
+ * together by pegprof(1).
+ */
+
+YY_PARSE(int) yyShowRulesProfileCSV(yycontext *yy, FILE *fp)
+{
+  fprintf(fp, "kind,name,id,line,index,succeed,fail,self,inclusive,tries,hits,wasted\n");
+  fprintf(fp, "input,%s,0,0,0,%llu,0,0,0,0,0,0\n", YY_PROFILE_UNIT, yy->__rules_input);
+  for(int i=1; i <= YYRULECOUNT; ++i)
+    fprintf(fp, "rule,%s,%d,%d,0,%llu,%llu,%llu,%llu,0,0,0\n", yyrulenames[i], i, yyrulelines[i],
+	    yy->__rules_succeed_count[i], yy->__rules_fail_count[i], yy->__rules_self_time[i], yy->__rules_total_time[i]);
+#ifndef YY_VM
+  for(int a=1; a <= YYALTCOUNT; ++a)
+    fprintf(fp, "alternative,%s,%d,%d,%d,0,0,0,0,%llu,%llu,%llu\n", yyrulenames[yyalternatives[a].rule], yyalternatives[a].rule,
+	    yyalternatives[a].line, yyalternatives[a].index, yy->__alt_tries[a], yy->__alt_hits[a], yy->__alt_waste[a]);
+#endif
+  return 0;
+}
+
+YY_PARSE(int) yyShowRulesProfileJSON(yycontext *yy, FILE *fp)
+{
+  fprintf(fp, "{\n  \"unit\": \"%s\",\n  \"input\": %llu,\n  \"rules\": [", YY_PROFILE_UNIT, yy->__rules_input);
+  for(int i=1; i <= YYRULECOUNT; ++i)
+    fprintf(fp, "%s\n    { \"name\": \"%s\", \"id\": %d, \"line\": %d, \"succeed\": %llu, \"fail\": %llu, \"self\": %llu, \"inclusive\": %llu }",
+	    i > 1 ? "," : "", yyrulenames[i], i, yyrulelines[i],
+	    yy->__rules_succeed_count[i], yy->__rules_fail_count[i], yy->__rules_self_time[i], yy->__rules_total_time[i]);
+  fprintf(fp, "\n  ],\n  \"alternatives\": [");
+#ifndef YY_VM
+  for(int a=1; a <= YYALTCOUNT; ++a)
+    fprintf(fp, "%s\n    { \"name\": \"%s\", \"id\": %d, \"line\": %d, \"index\": %d, \"tries\": %llu, \"hits\": %llu, \"wasted\": %llu }",
+	    a > 1 ? "," : "", yyrulenames[yyalternatives[a].rule], yyalternatives[a].rule, yyalternatives[a].line,
+	    yyalternatives[a].index, yy->__alt_tries[a], yy->__alt_hits[a], yy->__alt_waste[a]);
+#endif
+  fprintf(fp, "\n  ]\n}\n");
+  return 0;
+}
+#endif
+#ifdef YY_HEATMAP
+
+#ifndef YY_HEATMAP_WIDTH
+#define YY_HEATMAP_WIDTH 64
+#endif
+
+YY_PARSE(int) yyShowHeatMap(yycontext *yy, FILE *fp)
+{
+  static const char glyphs[]= " .:-=+*#%@";
+  long total= 0;
+  int i, start, line= 1, bytes= 0, max= 1;
+  for (i= 0;  i < yy->__heatlen;  ++i) {
+    total += yy->__heat[i];
+    if (yy->__heat[i]) ++bytes;
+    if (yy->__heat[i] > max) max= yy->__heat[i];
+  }
+  fprintf(fp, "Rescanned %d of %d bytes, %ld times in total (%.2f per byte)\n\n", bytes, yy->__heatlen, total,
+	  yy->__heatlen ? total / (yy->__heatlen * 1.0) : 0.0);
+  fprintf(fp, "%6s  %10s  %6s  %s\n", "line", "rescanned", "max", "text");
+  for (start= 0;  start < yy->__heatlen;  start= i + 1, ++line) {
+    long sum= 0;
+    int end, peak= 0, k;
+    for (i= start;  i < yy->__heatlen && '\n' != yy->__heattext[i];  ++i) {
+      sum += yy->__heat[i];
+      if (yy->__heat[i] > peak) peak= yy->__heat[i];
+    }
+    if (!sum) continue;
+    end= i - start > YY_HEATMAP_WIDTH ? start + YY_HEATMAP_WIDTH : i;
+    fprintf(fp, "%6d  %10ld  %6d  ", line, sum, peak);
+    for (k= start;  k < end;  ++k)
+      fputc(isprint((unsigned char)yy->__heattext[k]) ? yy->__heattext[k] : ' ', fp);
+    fprintf(fp, "%s\n%28s", end < i ? "..." : "", "");
+    while (end > start && !yy->__heat[end - 1]) --end;
+    for (k= start;  k < end;  ++k)
+      fputc(glyphs[(yy->__heat[k] * 9 + max - 1) / max], fp);
+    fputc('\n', fp);
+  }
+  return 0;
+}
+#endif
+#ifdef YY_RULE_STACK
+
+YY_PARSE(int) yyShowRuleStack(yycontext *yy, FILE *fp)
+{
+  int i, depth= yy->__stackdepth < YY_RULE_STACK_SIZE ? yy->__stackdepth : YY_RULE_STACK_SIZE;
+  for (i= 0;  i < depth;  ++i)
+    fprintf(fp, "%s%s", i ? ";" : "", yyrulenames[yy->__stack[i]]);
+  fprintf(fp, "\n");
+  return yy->__stackdepth;
+}
+#endif
+#ifdef YY_SAMPLER
+
+YY_PARSE(int) yyStartSampler(yycontext *yy, int usec)
+{
+  struct sigaction sa;
+  struct itimerval it;
+  yycontext *yyidle= 0;
+  if (!yy->__samples && !(yy->__samples= (int *)YY_MALLOC(yy, sizeof(int) * YY_SAMPLER_SIZE)))
+    return -1;
+  if (!__atomic_compare_exchange_n(&yysampled, &yyidle, yy, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) && yyidle != yy)
+    return -1;		/* the process timer is already sampling another context */
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler= yySampleSignal;
+  sa.sa_flags= SA_RESTART;
+  sigemptyset(&sa.sa_mask);
+  it.it_interval.tv_sec= usec / 1000000;
+  it.it_interval.tv_usec= usec % 1000000;
+  it.it_value= it.it_interval;
+  if (sigaction(SIGPROF, &sa, 0) || setitimer(ITIMER_PROF, &it, 0))
+    {
+      yysampled= 0;
+      return -1;
+    }
+  return 0;
+}
+
+YY_PARSE(void) yyStopSampler(yycontext *yy)
+{
+  struct itimerval it;
+  if (yysampled != yy) return;
+  memset(&it, 0, sizeof(it));
+  setitimer(ITIMER_PROF, &it, 0);
+  yysampled= 0;
+}
+
+YY_LOCAL(int) yySampleCompare(const void *a, const void *b)
+{
+  const int *p= *(const int **)a, *q= *(const int **)b;
+  int i, n= p[0] < q[0] ? p[0] : q[0];
+  for (i= 1;  i <= n;  ++i)
+    if (p[i] != q[i]) return p[i] - q[i];
+  return p[0] - q[0];
+}
+
+YY_PARSE(int) yyShowFoldedStacks(yycontext *yy, FILE *fp)
+{
+  int **samples, count= 0, i, j, k;
+  for (i= 0;  i < yy->__sampleslen;  i += yy->__samples[i] + 1)
+    ++count;
+  samples= (int **)YY_MALLOC(yy, sizeof(int *) * (count + 1));
+  for (i= j= 0;  i < yy->__sampleslen;  i += yy->__samples[i] + 1)
+    samples[j++]= yy->__samples + i;
+  qsort(samples, count, sizeof(int *), yySampleCompare);
+  for (i= 0;  i < count;  i= j)
+    {
+      for (j= i + 1;  j < count && !yySampleCompare(&samples[i], &samples[j]);  ++j)
+	;
+      for (k= 1;  k <= samples[i][0];  ++k)
+	fprintf(fp, "%s%s", k > 1 ? ";" : "", yyrulenames[samples[i][k]]);
+      fprintf(fp, " %d\n", j - i);
+    }
+  YY_FREE(yy, samples);
+  return count;
+}
+#endif
+#ifdef YY_TRACE
+
+YY_PARSE(int) yyDumpTrace(yycontext *yy, FILE *fp)
+{
+  unsigned long long n= yy->__tracecount < YY_TRACE_SIZE ? yy->__tracecount : YY_TRACE_SIZE, i;
+  fprintf(fp, "PEGTRACE %d %d %llu %llu\n", (int)sizeof(yytrace), YYRULECOUNT, yy->__tracecount, n);
+  for (i= 1;  i <= YYRULECOUNT;  ++i)
+    fprintf(fp, "%s\n", yyrulenames[i]);
+  for (i= yy->__tracecount - n;  i < yy->__tracecount;  ++i)
+    fwrite(&yy->__trace[i % YY_TRACE_SIZE], sizeof(yytrace), 1, fp);
   return 0;
 }
 #endif
@@ -1999,7 +3686,7 @@ YY_PARSE(void) yylinecol(const unsigned char *input, int offset, int *line_out,
 }
 
 #endif
-#line 175 "leg.leg"
+#line 179 "src/leg.leg"
 
 
 void yyerror(char *message)
@@ -2044,6 +3731,11 @@ static void usage(char *name)
   fprintf(stderr, "  -h          print this help information\n");
   fprintf(stderr, "  -o <ofile>  write output to <ofile>\n");
   fprintf(stderr, "  -P          do not generate #line directives\n");
+  fprintf(stderr, "  -b          generate a bytecode interpreter instead of C functions\n");
+  fprintf(stderr, "  -r          generate a reentrant parser (define YY_CTX_LOCAL)\n");
+  fprintf(stderr, "  -R          generate a recognizer without actions or variables\n");
+  fprintf(stderr, "  -O <pfile>  reorder alternatives using the profile in <pfile>\n");
+  fprintf(stderr, "  -a <pfile>  print the grammar annotated with the profile in <pfile>\n");
   fprintf(stderr, "  -p          output peg format\n");
   fprintf(stderr, "  -j          output pegjs/peggy format\n");
   fprintf(stderr, "  -n          output naked\n");
@@ -2065,7 +3757,7 @@ int main(int argc, char **argv)
   lineNumber= 1;
   fileName= "<stdin>";
 
-  while (-1 != (c= getopt(argc, argv, "PVho:vepnj")))
+  while (-1 != (c= getopt(argc, argv, "PVho:vepnjbrRO:a:")))
     {
       switch (c)
 	{
@@ -2085,6 +3777,26 @@ int main(int argc, char **argv)
 	  nolinesFlag= 1;
 	  break;
 
+	case 'b':
+	  bytecodeFlag= 1;
+	  break;
+
+	case 'r':
+	  reentrantFlag= 1;
+	  break;
+
+	case 'R':
+	  recognizer= 1;
+	  break;
+
+	case 'O':
+	  profileName= optarg;
+	  break;
+
+	case 'a':
+	  annotateName= optarg;
+	  break;
+
 	case 'v':
 	  verboseFlag= 1;
 	  break;
@@ -2146,6 +3858,12 @@ int main(int argc, char **argv)
     for (n= rules;  n;  n= n->any.next)
       Rule_print(n);
 
+  if (annotateName) {
+    Profile_read(annotateName);
+    Profile_print(!pegFlag, nakedFlag);
+    return 0;
+  }
+
   if (ebnfFlag)
     EBNF_print();
 
@@ -2168,7 +3886,10 @@ int main(int argc, char **argv)
     exit(1);
   }
 
-  Rule_compile_c_header();
+  if (profileName && rules)
+    Rule_apply_profile(rules, profileName);
+
+  Rule_compile_c_header(reentrantFlag);
 
   for (; headers;) {
     Header *tmp = headers;
@@ -2178,7 +3899,12 @@ int main(int argc, char **argv)
   }
 
   if (rules)
-    Rule_compile_c(rules, nolinesFlag);
+    {
+      if (bytecodeFlag)
+	Rule_compile_vm(rules, nolinesFlag);
+      else
+	Rule_compile_c(rules, nolinesFlag);
+    }
 
   if (trailer) {
     if (!nolinesFlag)
@@ -34,6 +34,8 @@ int   nakedFlag= 0;
 int   legFlag= 0;
 int   pegjsFlag= 0;
 int   nolinesFlag= 0;
+int   bytecodeFlag= 0;
+int   reentrantFlag= 0;
 
 static int   lineNumber= 0;
 static int   inputPos= 0;
@@ -41,6 +43,8 @@ static int   lineNumberPos= 0;
 static int   actionLine= 0;
 static char *fileName= 0;
 static char *outfileName= 0;
+static char *profileName= 0;
+static char *annotateName= 0;
 static int   headerLine= 0;
 static Trailer *trailer= 0;
 static Header  *headers= 0;
@@ -99,6 +103,11 @@ static void usage(char *name)
   fprintf(stderr, "  -h          print this help information\n");
   fprintf(stderr, "  -o <ofile>  write output to <ofile>\n");
   fprintf(stderr, "  -P          do not generate #line directives\n");
+  fprintf(stderr, "  -b          generate a bytecode interpreter instead of C functions\n");
+  fprintf(stderr, "  -r          generate a reentrant parser (define YY_CTX_LOCAL)\n");
+  fprintf(stderr, "  -R          generate a recognizer without actions or variables\n");
+  fprintf(stderr, "  -O <pfile>  reorder alternatives using the profile in <pfile>\n");
+  fprintf(stderr, "  -a <pfile>  print the grammar annotated with the profile in <pfile>\n");
   fprintf(stderr, "  -n          output naked\n");
   fprintf(stderr, "  -l          output leg format\n");
   fprintf(stderr, "  -j          output pegjs/peggy format\n");
@@ -120,7 +129,7 @@ int main(int argc, char **argv)
   lineNumber= 1;
   fileName= "<stdin>";
 
-  while (-1 != (c= getopt(argc, argv, "PVho:velnj")))
+  while (-1 != (c= getopt(argc, argv, "PVho:velnjbrRO:a:")))
     {
       switch (c)
 	{
@@ -140,6 +149,26 @@ int main(int argc, char **argv)
 	  nolinesFlag= 1;
 	  break;
 
+	case 'b':
+	  bytecodeFlag= 1;
+	  break;
+
+	case 'r':
+	  reentrantFlag= 1;
+	  break;
+
+	case 'R':
+	  recognizer= 1;
+	  break;
+
+	case 'O':
+	  profileName= optarg;
+	  break;
+
+	case 'a':
+	  annotateName= optarg;
+	  break;
+
 	case 'v':
 	  verboseFlag= 1;
 	  break;
@@ -201,6 +230,12 @@ int main(int argc, char **argv)
     for (n= rules;  n;  n= n->any.next)
       Rule_print(n);
 
+  if (annotateName) {
+    Profile_read(annotateName);
+    Profile_print(legFlag, nakedFlag);
+    return 0;
+  }
+
   if (ebnfFlag)
     EBNF_print();
 
@@ -223,7 +258,10 @@ int main(int argc, char **argv)
     exit(1);
   }
 
-  Rule_compile_c_header();
+  if (profileName && rules)
+    Rule_apply_profile(rules, profileName);
+
+  Rule_compile_c_header(reentrantFlag);
 
   for (; headers;) {
     Header *tmp = headers;
@@ -232,7 +270,13 @@ int main(int argc, char **argv)
     free(tmp);
   }
 
-  if (rules) Rule_compile_c(rules, nolinesFlag);
+  if (rules)
+    {
+      if (bytecodeFlag)
+	Rule_compile_vm(rules, nolinesFlag);
+      else
+	Rule_compile_c(rules, nolinesFlag);
+    }
 
   if (trailer) {
     if (!nolinesFlag)
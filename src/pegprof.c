@@ -0,0 +1,214 @@
+/* Copyright (c) 2007 by Ian Piumarta
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the 'Software'),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, provided that the above copyright notice(s) and this
+ * permission notice appear in all copies of the Software.  Acknowledgement
+ * of the use of this Software in supporting documentation would be
+ * appreciated but is not required.
+ *
+ * THE SOFTWARE IS PROVIDED 'AS IS'.  USE ENTIRELY AT YOUR OWN RISK.
+ */
+
+/* Merge rule profiles written by yyShowRulesProfileCSV().  Rows for the
+ * same rule or alternative are added together, so that profiles taken
+ * by several worker processes parsing with the same grammar can be read
+ * as one.  The result is written as CSV (which can be merged again, or
+ * given to 'peg -O') or as JSON.
+ */
+
+#include "version.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <libgen.h>
+
+#define HEADER	"kind,name,id,line,index,succeed,fail,self,inclusive,tries,hits,wasted"
+
+typedef unsigned long long count;
+
+typedef struct Row Row;
+struct Row {
+  char	*kind;
+  char	*name;
+  int	 id, line, index;
+  count	 succeed, fail, self, inclusive, tries, hits, wasted;
+};
+
+static Row	*rows= 0;
+static int	 rowCount= 0;
+static char	*fileName= 0;
+static int	 lineNumber= 0;
+
+static void error(char *message)
+{
+  fprintf(stderr, "%s:%d: %s\n", fileName, lineNumber, message);
+  exit(1);
+}
+
+static Row *findRow(char *kind, char *name, int index)
+{
+  int i;
+  for (i= 0;  i < rowCount;  ++i)
+    if (rows[i].index == index && !strcmp(rows[i].kind, kind) && !strcmp(rows[i].name, name))
+      return rows + i;
+  return 0;
+}
+
+static void readRow(char *text)
+{
+  char	kind[32], name[256];
+  Row	row, *old;
+
+  if (12 != sscanf(text, "%31[^,],%255[^,],%d,%d,%d,%llu,%llu,%llu,%llu,%llu,%llu,%llu", kind, name, &row.id, &row.line, &row.index,
+		   &row.succeed, &row.fail, &row.self, &row.inclusive, &row.tries, &row.hits, &row.wasted))
+    error("malformed row");
+  if (!(old= findRow(kind, name, row.index)))
+    {
+      rows= realloc(rows, sizeof(Row) * (rowCount + 1));
+      old= rows + rowCount++;
+      memset(old, 0, sizeof(Row));
+      old->kind= strdup(kind);
+      old->name= strdup(name);
+      old->id= row.id;
+      old->line= row.line;
+      old->index= row.index;
+    }
+  else if (old->id != row.id || old->line != row.line)
+    error("profile is of a different grammar");
+  old->succeed   += row.succeed;
+  old->fail      += row.fail;
+  old->self      += row.self;
+  old->inclusive += row.inclusive;
+  old->tries     += row.tries;
+  old->hits      += row.hits;
+  old->wasted    += row.wasted;
+}
+
+static void readProfile(FILE *in)
+{
+  char line[1024];
+  lineNumber= 0;
+  while (fgets(line, sizeof(line), in))
+    {
+      line[strcspn(line, "\r\n")]= '\0';
+      if (!lineNumber++)
+	{
+	  if (strcmp(line, HEADER)) error("not a rules profile");
+	  continue;
+	}
+      if (line[0]) readRow(line);
+    }
+}
+
+static void writeCSV(FILE *out)
+{
+  int i;
+  fprintf(out, "%s\n", HEADER);
+  for (i= 0;  i < rowCount;  ++i)
+    fprintf(out, "%s,%s,%d,%d,%d,%llu,%llu,%llu,%llu,%llu,%llu,%llu\n", rows[i].kind, rows[i].name, rows[i].id, rows[i].line, rows[i].index,
+	    rows[i].succeed, rows[i].fail, rows[i].self, rows[i].inclusive, rows[i].tries, rows[i].hits, rows[i].wasted);
+}
+
+static void writeJSON(FILE *out)
+{
+  Row  *input= 0;
+  char *sep= "";
+  int	i;
+
+  for (i= 0;  i < rowCount;  ++i)
+    if (!strcmp(rows[i].kind, "input"))
+      input= rows + i;
+  fprintf(out, "{\n  \"unit\": \"%s\",\n  \"input\": %llu,\n  \"rules\": [", input ? input->name : "", input ? input->succeed : 0);
+  for (i= 0;  i < rowCount;  ++i)
+    if (!strcmp(rows[i].kind, "rule"))
+      {
+	fprintf(out, "%s\n    { \"name\": \"%s\", \"id\": %d, \"line\": %d, \"succeed\": %llu, \"fail\": %llu, \"self\": %llu, \"inclusive\": %llu }",
+		sep, rows[i].name, rows[i].id, rows[i].line, rows[i].succeed, rows[i].fail, rows[i].self, rows[i].inclusive);
+	sep= ",";
+      }
+  fprintf(out, "\n  ],\n  \"alternatives\": [");
+  sep= "";
+  for (i= 0;  i < rowCount;  ++i)
+    if (!strcmp(rows[i].kind, "alternative"))
+      {
+	fprintf(out, "%s\n    { \"name\": \"%s\", \"id\": %d, \"line\": %d, \"index\": %d, \"tries\": %llu, \"hits\": %llu, \"wasted\": %llu }",
+		sep, rows[i].name, rows[i].id, rows[i].line, rows[i].index, rows[i].tries, rows[i].hits, rows[i].wasted);
+	sep= ",";
+      }
+  fprintf(out, "\n  ]\n}\n");
+}
+
+static void usage(char *name)
+{
+  printf("%s version %d.%d.%d\n", name, PEG_MAJOR, PEG_MINOR, PEG_LEVEL);
+  fprintf(stderr, "usage: %s [<option>...] [<file>...]\n", name);
+  fprintf(stderr, "where <option> can be\n");
+  fprintf(stderr, "  -h          print this help information\n");
+  fprintf(stderr, "  -o <ofile>  write output to <ofile>\n");
+  fprintf(stderr, "  -j          output JSON instead of CSV\n");
+  fprintf(stderr, "if no <file> is given, input is read from stdin\n");
+  fprintf(stderr, "if no <ofile> is given, output is written to stdout\n");
+  exit(1);
+}
+
+int main(int argc, char **argv)
+{
+  FILE *out= stdout;
+  int	json= 0, c;
+
+  while (-1 != (c= getopt(argc, argv, "ho:j")))
+    {
+      switch (c)
+	{
+	case 'o':
+	  if (!(out= fopen(optarg, "w")))
+	    {
+	      perror(optarg);
+	      exit(1);
+	    }
+	  break;
+
+	case 'j':
+	  json= 1;
+	  break;
+
+	case 'h':
+	default:
+	  usage(basename(argv[0]));
+	}
+    }
+  argc -= optind;
+  argv += optind;
+
+  if (!argc)
+    {
+      fileName= "<stdin>";
+      readProfile(stdin);
+    }
+  for (;  argc;  --argc, ++argv)
+    {
+      FILE *in= fopen(*argv, "r");
+      if (!in)
+	{
+	  perror(*argv);
+	  exit(1);
+	}
+      fileName= *argv;
+      readProfile(in);
+      fclose(in);
+    }
+
+  if (json)
+    writeJSON(out);
+  else
+    writeCSV(out);
+
+  return 0;
+}
@@ -0,0 +1,189 @@
+/* Copyright (c) 2007 by Ian Piumarta
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the 'Software'),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, provided that the above copyright notice(s) and this
+ * permission notice appear in all copies of the Software.  Acknowledgement
+ * of the use of this Software in supporting documentation would be
+ * appreciated but is not required.
+ *
+ * THE SOFTWARE IS PROVIDED 'AS IS'.  USE ENTIRELY AT YOUR OWN RISK.
+ */
+
+/* Decode a rule trace written by yyDumpTrace() from a parser compiled
+ * with YY_TRACE.  The events are printed as the indented rule trace that
+ * YY_DEBUG would have written to stderr.  If the parser's input is
+ * given, positions are shown as line:column instead of byte offsets.
+ */
+
+#include "version.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <libgen.h>
+
+enum { Enter= 0, Ok, Fail };
+
+typedef struct Event Event;
+struct Event {		/* must match yytrace in the generated parser */
+  int	pos, depth, rule, kind;
+};
+
+static char	 *fileName= 0;
+static int	 *lines= 0;
+static int	  lineCount= 0;
+
+static void error(char *message)
+{
+  fprintf(stderr, "%s: %s\n", fileName, message);
+  exit(1);
+}
+
+static void readInput(char *name)
+{
+  FILE *in= fopen(name, "r");
+  int	c, pos= 0;
+
+  if (!in)
+    {
+      perror(name);
+      exit(1);
+    }
+  lines= malloc(sizeof(int));
+  lines[lineCount++]= 0;
+  while (EOF != (c= getc(in)))
+    if ('\n' == (++pos, c))
+      {
+	lines= realloc(lines, sizeof(int) * (lineCount + 1));
+	lines[lineCount++]= pos;
+      }
+  fclose(in);
+}
+
+static char *position(int pos)
+{
+  static char buf[32];
+  int lo= 0, hi= lineCount - 1;
+
+  if (!lines)
+    {
+      snprintf(buf, sizeof(buf), "%d", pos);
+      return buf;
+    }
+  while (lo < hi)
+    {
+      int mid= (lo + hi + 1) / 2;
+      if (lines[mid] <= pos) lo= mid;
+      else		     hi= mid - 1;
+    }
+  snprintf(buf, sizeof(buf), "%d:%d", lo + 1, pos - lines[lo] + 1);
+  return buf;
+}
+
+static void decode(FILE *in)
+{
+  char		      line[1024], **names;
+  int		      size, ruleCount, i, base;
+  unsigned long long  total, count, n;
+  Event		     *events;
+
+  if (!fgets(line, sizeof(line), in) || 4 != sscanf(line, "PEGTRACE %d %d %llu %llu", &size, &ruleCount, &total, &count))
+    error("not a rule trace");
+  if (size != sizeof(Event))
+    error("trace written with a different event size");
+  names= calloc(ruleCount + 1, sizeof(char *));
+  for (i= 1;  i <= ruleCount;  ++i)
+    {
+      if (!fgets(line, sizeof(line), in))
+	error("truncated rule names");
+      line[strcspn(line, "\n")]= '\0';
+      names[i]= strdup(line);
+    }
+  events= malloc(sizeof(Event) * (count ? count : 1));
+  if (count != fread(events, sizeof(Event), count, in))
+    error("truncated events");
+
+  base= 0;
+  for (n= 0;  n < count;  ++n)
+    if (events[n].depth < base)
+      base= events[n].depth;
+  if (total > count)
+    printf("(%llu earlier events not recorded)\n", total - count);
+  for (n= 0;  n < count;  ++n)
+    {
+      Event *e= events + n;
+      char  *name= (e->rule > 0 && e->rule <= ruleCount) ? names[e->rule] : "?";
+      int    depth= e->depth - base;
+      switch (e->kind)
+	{
+	case Enter:	printf("%*.s%s\n", depth, "", name);					break;
+	case Ok:	printf("%*.s  ok   %s @%s\n", depth + 1, "", name, position(e->pos));	break;
+	case Fail:	printf("%*.s  fail %s @%s\n", depth + 1, "", name, position(e->pos));	break;
+	default:	error("unknown event");
+	}
+    }
+
+  for (i= 1;  i <= ruleCount;  ++i)
+    free(names[i]);
+  free(names);
+  free(events);
+}
+
+static void usage(char *name)
+{
+  printf("%s version %d.%d.%d\n", name, PEG_MAJOR, PEG_MINOR, PEG_LEVEL);
+  fprintf(stderr, "usage: %s [<option>...] [<file>]\n", name);
+  fprintf(stderr, "where <option> can be\n");
+  fprintf(stderr, "  -h          print this help information\n");
+  fprintf(stderr, "  -i <ifile>  show positions as line:column in <ifile>\n");
+  fprintf(stderr, "if no <file> is given, the trace is read from stdin\n");
+  exit(1);
+}
+
+int main(int argc, char **argv)
+{
+  int c;
+
+  while (-1 != (c= getopt(argc, argv, "hi:")))
+    {
+      switch (c)
+	{
+	case 'i':
+	  readInput(optarg);
+	  break;
+
+	case 'h':
+	default:
+	  usage(basename(argv[0]));
+	}
+    }
+  argc -= optind;
+  argv += optind;
+
+  if (!argc)
+    {
+      fileName= "<stdin>";
+      decode(stdin);
+    }
+  else
+    {
+      FILE *in= fopen(*argv, "rb");
+      if (!in)
+	{
+	  perror(*argv);
+	  exit(1);
+	}
+      fileName= *argv;
+      decode(in);
+      fclose(in);
+    }
+
+  free(lines);
+  return 0;
+}
@@ -35,6 +35,8 @@ Node *start= 0;
 
 FILE *output= 0;
 
+int recognizer= 0;
+
 int actionCount= 0;
 int ruleCount= 0;
 int lastToken= -1;
@@ -340,6 +342,58 @@ Node *pop(void)
   return *stackPointer--;
 }
 
+static void Node_free(Node *node)
+{
+  Node *n, *next;
+  switch (node->type)
+    {
+    case Variable:	free(node->variable.name);				break;
+    case Character:
+    case String:	free(node->string.value);				break;
+    case Class:		free(node->cclass.value);				break;
+    case Action:	free(node->action.text);  free(node->action.name);	break;
+    case Inline:	free(node->inLine.text);				break;
+    case Predicate:	free(node->predicate.text);				break;
+    case Error:		Node_free(node->error.element);  free(node->error.text);	break;
+    case Alternate:
+    case Sequence:
+      for (n= node->alternate.first;  n;  n= next)
+	{
+	  next= n->any.next;
+	  Node_free(n);
+	}
+      break;
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:		Node_free(node->query.element);				break;
+    default:									break;
+    }
+  free(node);
+}
+
+void freeRules(void)
+{
+  Node *n, *v, *next;
+  for (n= rules;  n;  n= next)
+    {
+      next= n->rule.next;
+      for (v= n->rule.variables;  v;  v= n->rule.variables)
+	{
+	  n->rule.variables= v->variable.next;
+	  Node_free(v);
+	}
+      if (n->rule.expression)
+	Node_free(n->rule.expression);
+      free(n->rule.name);
+      free(n);
+    }
+  rules= actions= start= thisRule= 0;
+  ruleCount= actionCount= 0;
+  stackPointer= stack;
+}
+
 
 static void Node_fprint(FILE *stream, Node *node, int depth, int asEbnf, int asLeg, int naked)
 {
@@ -500,6 +554,112 @@ void PEGJS_print(int naked) {
     free(oderedRules);
 }
 
+/* Print the grammar with the counts read by Profile_read() as comments.
+ * Each rule is preceded by its calls and self time; alternatives of a
+ * rule's top-level choice are annotated at the end of their line, and
+ * nested alternatives are listed before the rule with their number (as
+ * in the profile) and text.
+ */
+
+static void Alternative_fprint(FILE *stream, Sample *sample)
+{
+  if (!sample->tries)
+    fprintf(stream, "not tried");
+  else
+    fprintf(stream, "%llu tries, %llu hits (%.2f%%), %llu wasted", sample->tries, sample->hits,
+	    sample->hits * 100.0 / sample->tries, sample->wasted);
+}
+
+static int Profile_fprint_nested(FILE *stream, Node *rule, Node *node, int index, int top, int leg)
+{
+  switch (node->type)
+    {
+    case Error:		return Profile_fprint_nested(stream, rule, node->error.element, index, 0, leg);
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:		return Profile_fprint_nested(stream, rule, node->query.element, index, 0, leg);
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	index= Profile_fprint_nested(stream, rule, node, index, 0, leg);
+      return index;
+    case Alternate:
+      for (node= node->alternate.first;  node;  node= node->alternate.next)
+	{
+	  ++index;
+	  if (stream && !top)
+	    {
+	      fprintf(stream, "#   %d:", index);
+	      Node_fprint(stream, node, 1, 0, leg, 1);
+	      fprintf(stream, "  -- ");
+	      Alternative_fprint(stream, Profile_find(rule->rule.name, index));
+	      fprintf(stream, "\n");
+	    }
+	  index= Profile_fprint_nested(stream, rule, node, index, 0, leg);
+	}
+      return index;
+    default:
+      return index;
+    }
+}
+
+static void Rule_fprint_profile(FILE *stream, Node *rule, int leg, int naked, unsigned long long calls, unsigned long long self)
+{
+  Sample *sample= Profile_find(rule->rule.name, 0);
+  Node	 *node= rule->rule.expression;
+
+  if (sample->calls)
+    {
+      fprintf(stream, "# %llu calls (%.2f%%)", sample->calls, calls ? sample->calls * 100.0 / calls : 0.0);
+      if (sample->succeed || sample->fail)
+	fprintf(stream, ", %llu succeeded, %llu failed", sample->succeed, sample->fail);
+      fprintf(stream, ", self %llu (%.2f%%)\n", sample->self, self ? sample->self * 100.0 / self : 0.0);
+    }
+  else
+    fprintf(stream, "# not called\n");
+  if (node)
+    Profile_fprint_nested(stream, rule, node, 0, 1, leg);
+  fprintf(stream, "%s %s\n\t", rule->rule.name, leg ? "=" : "<-");
+  if (!node)
+    fprintf(stream, " UNDEFINED");
+  else if (Alternate == node->type)
+    {
+      int index= 0;
+      for (node= node->alternate.first;  node;  node= node->alternate.next)
+	{
+	  int number= ++index;
+	  if (number > 1) fprintf(stream, "\n\t%s", leg ? "|" : "/");
+	  Node_fprint(stream, node, 1, 0, leg, naked);
+	  fprintf(stream, "\t# ");
+	  Alternative_fprint(stream, Profile_find(rule->rule.name, number));
+	  index= Profile_fprint_nested(0, rule, node, index, 0, leg);
+	}
+    }
+  else
+    Node_fprint(stream, node, 0, 0, leg, naked);
+  fprintf(stream, leg ? "\n\t;\n\n" : "\n\n");
+}
+
+void Profile_print(int leg, int naked)
+{
+  unsigned long long calls= 0, self= 0;
+  Node  **oderedRules = getOrderedRules();
+  Sample *sample;
+  int	  i;
+
+  for (i= 0;  i < ruleCount;  ++i)
+    {
+      sample= Profile_find(oderedRules[i]->rule.name, 0);
+      calls += sample->calls;
+      self += sample->self;
+    }
+  fprintf(stdout, "# %llu calls, self time %llu\n\n", calls, self);
+  for (i= ruleCount - 1;  i >= 0;  --i)
+    Rule_fprint_profile(stdout, oderedRules[i], leg, naked, calls, self);
+  free(oderedRules);
+}
+
 Header *makeHeader(Header *head, int line, char *text)
 {
   Header *header= (Header *)malloc(sizeof(Header));
@@ -38,7 +38,7 @@ struct Action	 { NodeType type;  Node *next;   char *text;  Node *list;  char *n
 struct Inline    { NodeType type;  Node *next;   char *text;									};
 struct Predicate { NodeType type;  Node *next;   char *text;									};
 struct Error	 { NodeType type;  Node *next;   Node *element;  char *text;							};
-struct Alternate { NodeType type;  Node *next;   Node *first;  Node *last;							};
+struct Alternate { NodeType type;  Node *next;   Node *first;  Node *last;  int number;					};
 struct Sequence	 { NodeType type;  Node *next;   Node *first;  Node *last;							};
 struct PeekFor	 { NodeType type;  Node *next;   Node *element;								};
 struct PeekNot	 { NodeType type;  Node *next;   Node *element;								};
@@ -79,6 +79,8 @@ extern int   ruleCount;
 
 extern FILE *output;
 
+extern int   recognizer;
+
 extern Node *makeRule(char *name);
 extern Node *findRule(char *name);
 extern Node *beginRule(Node *rule, int line);
@@ -108,9 +110,41 @@ extern Node *makePlus(Node *e);
 extern Node *push(Node *node);
 extern Node *top(void);
 extern Node *pop(void);
+extern void  freeRules(void);
+
+typedef struct Sample Sample;
+struct Sample {
+  char			*rule;
+  int			 index;		/* alternative number, or 0 for the rule itself */
+  unsigned long long	 calls, succeed, fail, self, tries, hits, wasted;
+};
+
+extern void    Profile_read(char *fileName);
+extern Sample *Profile_find(char *rule, int index);
 
-extern void  Rule_compile_c_header(void);
+extern void  Rule_apply_profile(Node *node, char *fileName);
+extern void  Rule_compile_c_header(int reentrant);
 extern void  Rule_compile_c(Node *node, int nolines);
+extern void  Rule_compile_vm(Node *node, int nolines);
+
+typedef enum { opCall, opRet, opChoice, opErrChoice, opCommit, opPartialCommit, opBackCommit, opFailTwice, opFail,
+	       opDot, opChar, opCharI, opString, opStringI, opClass, opClassI, opBegin, opEnd, opPredicate, opInline,
+	       opAction, opSet, opPush, opPop, opCount } VmOp;
+
+typedef struct Program Program;
+struct Program {
+  int	 *code;		int length;
+  int	 *entries;				/* indexed by rule id */
+  char	**strings;	int stringCount;	/* C string literal text */
+  char	**classes;	int classCount;		/* 32 octal escapes per class */
+  Node	**fragments;	int fragmentCount;	/* predicate, inline and error nodes */
+};
+
+extern Program *Rule_compile_program(Node *node);
+extern void	Program_free(Program *program);
+extern void	Rule_compute_first(Node *node, unsigned char (*first)[32], char *nullable);
+extern int	cnext(unsigned char **ccp);
+extern char    *makeCharClass(unsigned char *cclass, int caseInsensitive);
 
 extern void  Node_print(Node *node);
 extern void  Rule_print(Node *node);
@@ -118,6 +152,7 @@ extern void  EBNF_print();
 extern void  LEG_print(int naked);
 extern void  PEG_print(int naked);
 extern void  PEGJS_print(int naked);
+extern void  Profile_print(int leg, int naked);
 
 typedef struct Header Header;
 struct Header {